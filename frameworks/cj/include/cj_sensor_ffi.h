@@ -74,9 +74,23 @@ typedef struct {
     int64_t size;
 } CSensorArray;
 
+typedef struct {
+    int64_t reportInterval;
+    int32_t maxBatchSize;
+    bool latestOnly;
+} CSensorBatchOptions;
+
+typedef struct {
+    SensorEvent *head;
+    int64_t size;
+} CSensorEventArray;
+
 SENSOR_FFI_EXPORT int32_t FfiSensorSubscribeSensor(int32_t sensorId, int64_t interval,
                                                    void (*callback)(SensorEvent *event));
 
+SENSOR_FFI_EXPORT int32_t FfiSensorSubscribeSensorBatch(int32_t sensorId, int64_t interval,
+                                                        CSensorBatchOptions options,
+                                                        void (*callback)(CSensorEventArray events));
 SENSOR_FFI_EXPORT int32_t FfiSensorUnSubscribeSensor(int32_t sensorId);
 SENSOR_FFI_EXPORT CGeomagneticData FfiSensorGetGeomagneticInfo(CLocationOptions location, int64_t timeMillis);
 SENSOR_FFI_EXPORT int32_t FfiSensorGetDeviceAltitude(float seaPressure, float currentPressure, float *altitude);
@@ -18,15 +18,39 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 #include "cj_sensor_ffi.h"
+#include "event_handler.h"
 #include "sensor_agent_type.h"
 #include "singleton.h"
 
 namespace OHOS {
 namespace Sensors {
 using SensorCallbackType = std::function<void(SensorEvent *)>;
+using SensorBatchCallbackType = std::function<void(CSensorEventArray)>;
+
+/**
+ * Batched CJ subscription. Events and their payloads are copied into storage that is allocated once
+ * at subscribe time, and the CJ callback receives a span over it that is only valid during the call.
+ * In latest-only mode a newer event overwrites the pending one instead of being appended.
+ * A partial batch is flushed reportInterval after its first event even if no further event arrives,
+ * and on unsubscribe. generation is bumped on every flush so a stale deadline task does nothing.
+ */
+struct CJSensorBatch {
+    std::recursive_mutex mutex;
+    SensorBatchCallbackType callback;
+    int64_t reportInterval = 0;
+    bool latestOnly = false;
+    std::vector<SensorEvent> events;
+    std::vector<uint8_t> data;
+    size_t count = 0;
+    int64_t firstTimestamp = 0;
+    uint64_t generation = 0;
+};
 
 class CJSensorImpl {
     DECLARE_DELAYED_SINGLETON(CJSensorImpl);
@@ -34,6 +58,8 @@ class CJSensorImpl {
 public:
     DISALLOW_COPY_AND_MOVE(CJSensorImpl);
     int32_t OnSensorChange(int32_t sensorId, int64_t interval, void (*callback)(SensorEvent *event));
+    int32_t OnSensorChangeBatch(int32_t sensorId, int64_t interval, const CSensorBatchOptions &options,
+                                void (*callback)(CSensorEventArray events));
     int32_t OffSensorChange(int32_t sensorId);
     void EmitCallBack(SensorEvent *event);
 
@@ -53,14 +79,22 @@ public:
 
 private:
     std::map<int32_t, SensorCallbackType> eventMap_;
+    std::map<int32_t, std::shared_ptr<CJSensorBatch>> batchMap_;
     std::mutex mutex_;
+    std::shared_ptr<AppExecFwk::EventHandler> flushHandler_ = nullptr;
 
-    int32_t SubscribeSensorImpl(int32_t sensorId, int64_t interval);
+    int32_t SubscribeSensorImpl(int32_t sensorId, int64_t interval, int64_t reportInterval = 0);
     int32_t UnsubscribeSensorImpl(int32_t sensorTypeId);
 
     void DelCallback(int32_t type);
     void AddCallback2Map(int32_t type, SensorCallbackType callback);
     std::optional<SensorCallbackType> FindCallback(int32_t type);
+    std::shared_ptr<CJSensorBatch> CreateBatch(const CSensorBatchOptions &options, SensorBatchCallbackType callback);
+    void AddBatch2Map(int32_t type, std::shared_ptr<CJSensorBatch> batch);
+    std::shared_ptr<CJSensorBatch> FindBatch(int32_t type);
+    void EmitBatchCallBack(std::shared_ptr<CJSensorBatch> batch, SensorEvent *event);
+    void FlushBatch(CJSensorBatch &batch);
+    void ScheduleBatchFlush(std::shared_ptr<CJSensorBatch> batch);
 
     char *MallocCString(const std::string origin);
     void Transform2CSensor(const SensorInfo &in, CSensor &out);
@@ -27,6 +27,17 @@ int32_t FfiSensorSubscribeSensor(int32_t sensorId, int64_t interval, void (*call
     return CJ_SENSOR_IMPL->OnSensorChange(sensorId, interval, callback);
 }
 
+int32_t FfiSensorSubscribeSensorBatch(int32_t sensorId, int64_t interval, CSensorBatchOptions options,
+                                      void (*callback)(CSensorEventArray events))
+{
+    if (callback == nullptr) {
+        SEN_HILOGE("Invalid parameter, callback is nullptr!");
+        return PARAMETER_ERROR;
+    }
+
+    return CJ_SENSOR_IMPL->OnSensorChangeBatch(sensorId, interval, options, callback);
+}
+
 int32_t FfiSensorUnSubscribeSensor(int32_t sensorId)
 {
     return CJ_SENSOR_IMPL->OffSensorChange(sensorId);
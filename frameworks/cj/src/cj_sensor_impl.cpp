@@ -15,10 +15,15 @@
 
 #include "cj_sensor_impl.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 #include "cj_lambda.h"
 #include "geomagnetic_field.h"
+#include "securec.h"
 #include "sensor_agent.h"
 #include "sensor_algorithm.h"
+#include "sensor_data_event.h"
 #include "sensor_errors.h"
 
 namespace OHOS {
@@ -28,6 +33,8 @@ constexpr int32_t ROTATION_VECTOR_LENGTH = 3;
 constexpr int32_t QUATERNION_LENGTH = 4;
 constexpr int32_t THREE_DIMENSIONAL_MATRIX_LENGTH = 9;
 constexpr int32_t DATA_LENGTH = 16;
+constexpr int32_t MAX_BATCH_SIZE = 256;
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000000;
 } // namespace
 
 CJSensorImpl::CJSensorImpl() {}
@@ -39,7 +46,7 @@ void CJSensorImpl::CJDataCallbackImpl(SensorEvent *event)
     CJ_SENSOR_IMPL->EmitCallBack(event);
 }
 
-int32_t CJSensorImpl::SubscribeSensorImpl(int32_t sensorId, int64_t interval)
+int32_t CJSensorImpl::SubscribeSensorImpl(int32_t sensorId, int64_t interval, int64_t reportInterval)
 {
     CALL_LOG_ENTER;
     int32_t ret = SubscribeSensor(sensorId, &cjUser_);
@@ -47,7 +54,7 @@ int32_t CJSensorImpl::SubscribeSensorImpl(int32_t sensorId, int64_t interval)
         SEN_HILOGE("SubscribeSensor failed");
         return ret;
     }
-    ret = SetBatch(sensorId, &cjUser_, interval, 0);
+    ret = SetBatch(sensorId, &cjUser_, interval, reportInterval);
     if (ret != ERR_OK) {
         SEN_HILOGE("SetBatch failed");
         return ret;
@@ -146,6 +153,42 @@ int32_t CJSensorImpl::OnSensorChange(int32_t sensorId, int64_t interval, void (*
     return ERR_OK;
 }
 
+int32_t CJSensorImpl::OnSensorChangeBatch(int32_t sensorId, int64_t interval, const CSensorBatchOptions &options,
+                                          void (*callback)(CSensorEventArray events))
+{
+    CALL_LOG_ENTER;
+    if (options.reportInterval < 0 || options.maxBatchSize <= 0 || options.maxBatchSize > MAX_BATCH_SIZE) {
+        SEN_HILOGE("Invalid batch options, reportInterval:%{public}" PRId64 ", maxBatchSize:%{public}d",
+            options.reportInterval, options.maxBatchSize);
+        return PARAMETER_ERROR;
+    }
+    auto batch = CreateBatch(options, CJLambda::Create(callback));
+    int32_t ret = SubscribeSensorImpl(sensorId, interval, options.latestOnly ? 0 : options.reportInterval);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("subscribe sensor failed, %{public}d.", sensorId);
+        return ret;
+    }
+
+    AddBatch2Map(sensorId, batch);
+    return ERR_OK;
+}
+
+std::shared_ptr<CJSensorBatch> CJSensorImpl::CreateBatch(const CSensorBatchOptions &options,
+                                                         SensorBatchCallbackType callback)
+{
+    auto batch = std::make_shared<CJSensorBatch>();
+    batch->callback = callback;
+    batch->reportInterval = options.reportInterval;
+    batch->latestOnly = options.latestOnly;
+    size_t capacity = options.latestOnly ? 1 : static_cast<size_t>(options.maxBatchSize);
+    batch->events.resize(capacity);
+    batch->data.resize(capacity * SENSOR_MAX_LENGTH);
+    for (size_t i = 0; i < capacity; ++i) {
+        batch->events[i].data = &batch->data[i * SENSOR_MAX_LENGTH];
+    }
+    return batch;
+}
+
 int32_t CJSensorImpl::OffSensorChange(int32_t sensorId)
 {
     CALL_LOG_ENTER;
@@ -155,12 +198,93 @@ int32_t CJSensorImpl::OffSensorChange(int32_t sensorId)
         return ret;
     }
 
+    auto batch = FindBatch(sensorId);
     DelCallback(sensorId);
+    if (batch != nullptr) {
+        FlushBatch(*batch);
+    }
     return ERR_OK;
 }
 
+void CJSensorImpl::FlushBatch(CJSensorBatch &batch)
+{
+    std::lock_guard<std::recursive_mutex> batchLock(batch.mutex);
+    if (batch.count == 0) {
+        return;
+    }
+    CSensorEventArray events = { .head = batch.events.data(), .size = static_cast<int64_t>(batch.count) };
+    batch.count = 0;
+    ++batch.generation;
+    batch.callback(events);
+}
+
+void CJSensorImpl::ScheduleBatchFlush(std::shared_ptr<CJSensorBatch> batch)
+{
+    {
+        std::lock_guard<std::mutex> mutex(mutex_);
+        if (flushHandler_ == nullptr) {
+            auto runner = AppExecFwk::EventRunner::Create(true, AppExecFwk::ThreadMode::FFRT);
+            CHKPV(runner);
+            flushHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+        }
+    }
+    std::weak_ptr<CJSensorBatch> weakBatch = batch;
+    uint64_t generation = batch->generation;
+    auto task = [this, weakBatch, generation]() {
+        auto batch = weakBatch.lock();
+        if (batch == nullptr) {
+            return;
+        }
+        std::lock_guard<std::recursive_mutex> batchLock(batch->mutex);
+        if (batch->generation == generation) {
+            FlushBatch(*batch);
+        }
+    };
+    int64_t delayTime = (batch->reportInterval + NANOSECONDS_PER_MILLISECOND - 1) / NANOSECONDS_PER_MILLISECOND;
+    if (!flushHandler_->PostTask(task, "", delayTime)) {
+        SEN_HILOGW("Post batch flush task failed");
+    }
+}
+
+void CJSensorImpl::EmitBatchCallBack(std::shared_ptr<CJSensorBatch> batchPtr, SensorEvent *event)
+{
+    CJSensorBatch &batch = *batchPtr;
+    std::lock_guard<std::recursive_mutex> batchLock(batch.mutex);
+    size_t slot = batch.latestOnly ? 0 : batch.count;
+    SensorEvent &target = batch.events[slot];
+    uint32_t dataLen = std::min(event->dataLen, static_cast<uint32_t>(SENSOR_MAX_LENGTH));
+    if (dataLen > 0 && memcpy_s(target.data, SENSOR_MAX_LENGTH, event->data, dataLen) != EOK) {
+        SEN_HILOGE("memcpy_s failed");
+        return;
+    }
+    target.sensorTypeId = event->sensorTypeId;
+    target.version = event->version;
+    target.timestamp = event->timestamp;
+    target.option = event->option;
+    target.mode = event->mode;
+    target.dataLen = dataLen;
+    bool isFirst = (batch.count == 0);
+    if (isFirst) {
+        batch.firstTimestamp = event->timestamp;
+    }
+    batch.count = batch.latestOnly ? 1 : batch.count + 1;
+    bool isFull = !batch.latestOnly && (batch.count >= batch.events.size());
+    if (!isFull && (event->timestamp - batch.firstTimestamp < batch.reportInterval)) {
+        if (isFirst) {
+            ScheduleBatchFlush(batchPtr);
+        }
+        return;
+    }
+    FlushBatch(batch);
+}
+
 void CJSensorImpl::EmitCallBack(SensorEvent *event)
 {
+    auto batch = FindBatch(event->sensorTypeId);
+    if (batch != nullptr) {
+        EmitBatchCallBack(batch, event);
+        return;
+    }
     auto callback = FindCallback(event->sensorTypeId);
     if (callback == std::nullopt) {
         SEN_HILOGE("EmitCallBack failed, %{public}d not find.", event->sensorTypeId);
@@ -173,13 +297,33 @@ void CJSensorImpl::EmitCallBack(SensorEvent *event)
 void CJSensorImpl::AddCallback2Map(int32_t type, SensorCallbackType callback)
 {
     std::lock_guard<std::mutex> mutex(mutex_);
+    batchMap_.erase(type);
     eventMap_[type] = callback;
 }
 
+void CJSensorImpl::AddBatch2Map(int32_t type, std::shared_ptr<CJSensorBatch> batch)
+{
+    std::lock_guard<std::mutex> mutex(mutex_);
+    eventMap_.erase(type);
+    batchMap_[type] = batch;
+}
+
 void CJSensorImpl::DelCallback(int32_t type)
 {
     std::lock_guard<std::mutex> mutex(mutex_);
     eventMap_.erase(type);
+    batchMap_.erase(type);
+}
+
+std::shared_ptr<CJSensorBatch> CJSensorImpl::FindBatch(int32_t type)
+{
+    std::lock_guard<std::mutex> mutex(mutex_);
+    auto iter = batchMap_.find(type);
+    if (iter != batchMap_.end()) {
+        return iter->second;
+    }
+
+    return nullptr;
 }
 
 std::optional<SensorCallbackType> CJSensorImpl::FindCallback(int32_t type)
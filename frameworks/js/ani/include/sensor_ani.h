@@ -16,6 +16,9 @@
 #define SENSOR_ANI_H
 
 #include <ani.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <iostream>
 #include <unordered_map>
@@ -28,6 +31,7 @@
 #include "sensor_agent_type.h"
 #include "sensor_errors.h"
 #include "sensor_log.h"
+#include "sensor_staging_buffer.h"
 
 #undef LOG_TAG
 #define LOG_TAG "SensorAniAPI"
@@ -38,7 +42,6 @@ using std::vector;
 using std::string;
 using namespace OHOS::HiviewDFX;
 constexpr int32_t THREE_DIMENSIONAL_MATRIX_LENGTH = 9;
-constexpr static int32_t DATA_LENGTH = 16;
 constexpr int32_t CALLBACK_NUM = 3;
 enum CallbackDataType {
     SUBSCRIBE_FAIL = -2,
@@ -77,14 +80,6 @@ struct RationMatrixData {
     float inclinationMatrix[THREE_DIMENSIONAL_MATRIX_LENGTH];
 };
 
-struct CallbackSensorData {
-    int32_t sensorTypeId;
-    uint32_t dataLength;
-    float data[DATA_LENGTH];
-    int64_t timestamp;
-    int32_t sensorAccuracy;
-};
-
 struct ReserveData {
     float reserve[DATA_LENGTH];
     int32_t length;
@@ -113,6 +108,13 @@ public:
     BusinessError error;
     CallbackDataType type;
     vector<SensorInfo> sensorInfos;
+    std::shared_ptr<SensorStagingBuffer> staging = nullptr;
+    vector<CallbackSensorData> deliverySamples;
+    uint64_t readSeq = 0;
+    std::atomic_bool taskPending = false;
+    std::atomic<int64_t> lastDeliverTime = 0;
+    bool isBatch = false;
+    int64_t coalesceInterval = 0;
     AsyncCallbackInfo(ani_vm *vm, ani_env *env, CallbackDataType type) : vm(vm), env(env), type(type) {}
     ~AsyncCallbackInfo()
     {
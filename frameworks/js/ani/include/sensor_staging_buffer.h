@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SENSOR_STAGING_BUFFER_H
+#define SENSOR_STAGING_BUFFER_H
+
+#include <mutex>
+#include <vector>
+
+#include "sensor_agent_type.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr static int32_t DATA_LENGTH = 16;
+constexpr uint32_t STAGING_CAPACITY = 128;
+
+struct CallbackSensorData {
+    int32_t sensorTypeId;
+    uint32_t dataLength;
+    float data[DATA_LENGTH];
+    int64_t timestamp;
+    int32_t sensorAccuracy;
+};
+
+/**
+ * Samples of one sensor type, copied once from the sensor callback thread and shared by every
+ * subscriber of that type. Each subscriber drains it from its own read sequence on the main thread.
+ */
+class SensorStagingBuffer {
+public:
+    SensorStagingBuffer() = default;
+    ~SensorStagingBuffer() = default;
+    bool Push(const SensorEvent &event);
+    uint64_t GetWriteSeq();
+    uint64_t Collect(uint64_t readSeq, bool latestOnly, std::vector<CallbackSensorData> &samples);
+
+private:
+    std::mutex mutex_;
+    uint64_t writeSeq_ { 0 };
+    CallbackSensorData samples_[STAGING_CAPACITY] {};
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // SENSOR_STAGING_BUFFER_H
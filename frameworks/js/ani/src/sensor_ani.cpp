@@ -14,6 +14,10 @@
  */
 
 #include "sensor_ani.h"
+
+#include <chrono>
+#include <cmath>
+
 #include "securec.h"
 #include "ani_utils.h"
 #include "sensor_agent.h"
@@ -30,6 +34,7 @@ constexpr int32_t INVALID_SENSOR_ID = -1;
 constexpr float BODY_STATE_EXCEPT = 1.0f;
 constexpr float THRESHOLD = 0.000001f;
 constexpr int32_t ANI_SCOPE_SIZE = 16;
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000000;
 
 static std::unordered_map<int, std::string> g_sensorTypeToClassName = {
     {256, "LOrientationResponseImpl;"},
@@ -81,11 +86,12 @@ static std::map<int32_t, ConvertDataFunc> g_convertfuncList = {
 };
 
 static std::mutex mutex_;
-static std::mutex bodyMutex_;
-static float g_bodyState = -1.0f;
 static std::map<int32_t, std::vector<sptr<AsyncCallbackInfo>>> g_subscribeCallbacks;
 static std::mutex onMutex_;
 static std::map<int32_t, std::vector<sptr<AsyncCallbackInfo>>> g_onCallbackInfos;
+static std::map<int32_t, std::shared_ptr<SensorStagingBuffer>> g_stagingBuffers;
+static std::mutex bodyMutex_;
+static float g_bodyState = -1.0f;
 static thread_local std::shared_ptr<OHOS::AppExecFwk::EventHandler> mainHandler = nullptr;
 
 static void ThrowBusinessError(ani_env *env, int errCode, std::string&& errMsg)
@@ -132,36 +138,6 @@ static bool CheckSubscribe(int32_t sensorTypeId)
     return iter != g_onCallbackInfos.end();
 }
 
-static bool CopySensorData(sptr<AsyncCallbackInfo> callbackInfo, SensorEvent *event)
-{
-    CHKPF(callbackInfo);
-    CHKPF(event);
-    int32_t sensorTypeId = event->sensorTypeId;
-    callbackInfo->data.sensorData.sensorTypeId = sensorTypeId;
-    callbackInfo->data.sensorData.dataLength = event->dataLen;
-    callbackInfo->data.sensorData.timestamp = event->timestamp;
-    callbackInfo->data.sensorData.sensorAccuracy = event->option;
-    CHKPF(event->data);
-    if (event->dataLen < sizeof(float)) {
-        SEN_HILOGE("Event dataLen less than float size");
-        return false;
-    }
-    auto data = reinterpret_cast<float *>(event->data);
-    if (sensorTypeId == SENSOR_TYPE_ID_WEAR_DETECTION && callbackInfo->type == SUBSCRIBE_CALLBACK) {
-        std::lock_guard<std::mutex> onBodyLock(bodyMutex_);
-        g_bodyState = *data;
-        callbackInfo->data.sensorData.data[0] =
-            (fabs(g_bodyState - BODY_STATE_EXCEPT) < THRESHOLD) ? true : false;
-        return true;
-    }
-    if (memcpy_s(callbackInfo->data.sensorData.data, sizeof(callbackInfo->data.sensorData.data),
-        data, event->dataLen) != EOK) {
-        SEN_HILOGE("Copy data failed");
-        return false;
-    }
-    return true;
-}
-
 static bool CheckSystemSubscribe(int32_t sensorTypeId)
 {
     std::lock_guard<std::mutex> subscribeLock(mutex_);
@@ -185,7 +161,7 @@ static ani_boolean IsInstanceOf(ani_env *env, const std::string &cls_name, ani_o
     return ret;
 }
 
-static bool SendEventToMainThread(const std::function<void()> func)
+static bool SendEventToMainThread(const std::function<void()> func, int64_t delayTime)
 {
     if (func == nullptr) {
         SEN_HILOGE("func is nullptr!");
@@ -200,7 +176,7 @@ static bool SendEventToMainThread(const std::function<void()> func)
         }
         mainHandler = std::make_shared<OHOS::AppExecFwk::EventHandler>(runner);
     }
-    mainHandler->PostTask(func, "", 0, OHOS::AppExecFwk::EventQueue::Priority::HIGH, {});
+    mainHandler->PostTask(func, "", delayTime, OHOS::AppExecFwk::EventQueue::Priority::HIGH, {});
     return true;
 }
 
@@ -339,9 +315,116 @@ static bool ConvertToSensorData(sptr<AsyncCallbackInfo> asyncCallbackInfo, std::
     return true;
 }
 
+static int64_t GetSteadyTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static int64_t GetDeliverDelay(sptr<AsyncCallbackInfo> asyncCallbackInfo)
+{
+    if (asyncCallbackInfo->coalesceInterval <= 0) {
+        return 0;
+    }
+    int64_t remaining = asyncCallbackInfo->lastDeliverTime.load() + asyncCallbackInfo->coalesceInterval -
+        GetSteadyTime();
+    if (remaining <= 0) {
+        return 0;
+    }
+    return (remaining + NANOSECONDS_PER_MILLISECOND - 1) / NANOSECONDS_PER_MILLISECOND;
+}
+
+static bool CallSensorCallback(ani_env *env, ani_fn_object fnObj, ani_ref arg)
+{
+    ani_ref result;
+    if (ANI_OK != env->FunctionalObject_Call(fnObj, 1, &arg, &result)) {
+        SEN_HILOGE("FunctionalObject_Call failed");
+        ThrowBusinessError(env, EINVAL, "FunctionalObject_Call failed");
+        return false;
+    }
+    return true;
+}
+
+static bool CallBatchCallback(sptr<AsyncCallbackInfo> asyncCallbackInfo, ani_fn_object fnObj,
+    std::vector<ani_ref> &objects)
+{
+    ani_env *env = asyncCallbackInfo->env;
+    ani_type type;
+    if (ANI_OK != env->Object_GetType(static_cast<ani_object>(objects[0]), &type)) {
+        SEN_HILOGE("Object_GetType failed");
+        return false;
+    }
+    ani_array_ref array;
+    if (ANI_OK != env->Array_New_Ref(type, objects.size(), objects[0], &array)) {
+        SEN_HILOGE("Array_New_Ref failed");
+        return false;
+    }
+    for (size_t i = 1; i < objects.size(); ++i) {
+        if (ANI_OK != env->Array_Set_Ref(array, i, objects[i])) {
+            SEN_HILOGE("Array_Set_Ref failed");
+            return false;
+        }
+    }
+    return CallSensorCallback(env, fnObj, array);
+}
+
+static void UpdateBodyState(sptr<AsyncCallbackInfo> asyncCallbackInfo)
+{
+    CallbackSensorData &sensorData = asyncCallbackInfo->data.sensorData;
+    if (sensorData.sensorTypeId != SENSOR_TYPE_ID_WEAR_DETECTION || asyncCallbackInfo->type != SUBSCRIBE_CALLBACK) {
+        return;
+    }
+    std::lock_guard<std::mutex> onBodyLock(bodyMutex_);
+    g_bodyState = sensorData.data[0];
+    sensorData.data[0] = (fabs(g_bodyState - BODY_STATE_EXCEPT) < THRESHOLD) ? true : false;
+}
+
+static void DeliverSamples(sptr<AsyncCallbackInfo> asyncCallbackInfo)
+{
+    auto &samples = asyncCallbackInfo->deliverySamples;
+    AniLocalScopeGuard aniLocalScopeGuard(asyncCallbackInfo->env, ANI_SCOPE_SIZE + samples.size());
+    if (!aniLocalScopeGuard.IsStatusOK()) {
+        SEN_HILOGE("CreateLocalScope failed");
+        return;
+    }
+    if (!(g_convertfuncList.find(asyncCallbackInfo->type) != g_convertfuncList.end())) {
+        SEN_HILOGE("asyncCallbackInfo type is invalid");
+        ThrowBusinessError(asyncCallbackInfo->env, EINVAL, "asyncCallbackInfo type is invalid");
+        return;
+    }
+    auto fnObj = reinterpret_cast<ani_fn_object>(asyncCallbackInfo->callback[0]);
+    if (fnObj == nullptr) {
+        SEN_HILOGE("fnObj == nullptr");
+        ThrowBusinessError(asyncCallbackInfo->env, EINVAL, "fnObj == nullptr");
+        return;
+    }
+    if (IsInstanceOf(asyncCallbackInfo->env, "Lstd/core/Function1;", fnObj) == 0) {
+        SEN_HILOGE("fnObj is not instance Of function");
+        ThrowBusinessError(asyncCallbackInfo->env, EINVAL, "fnObj is not instance Of function");
+        return;
+    }
+    std::vector<ani_ref> args;
+    args.reserve(samples.size());
+    for (const auto &sample : samples) {
+        asyncCallbackInfo->data.sensorData = sample;
+        UpdateBodyState(asyncCallbackInfo);
+        if (!g_convertfuncList[asyncCallbackInfo->type](asyncCallbackInfo, args)) {
+            SEN_HILOGE("Convert sensor data failed");
+            continue;
+        }
+        if (!asyncCallbackInfo->isBatch) {
+            CallSensorCallback(asyncCallbackInfo->env, fnObj, args.back());
+        }
+    }
+    if (asyncCallbackInfo->isBatch && !args.empty()) {
+        CallBatchCallback(asyncCallbackInfo, fnObj, args);
+    }
+}
+
 static void EmitUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo)
 {
     CHKPV(asyncCallbackInfo);
+    CHKPV(asyncCallbackInfo->staging);
     auto task = [asyncCallbackInfo]() {
         SEN_HILOGD("Begin to call task");
         ani_env *env = nullptr;
@@ -349,50 +432,28 @@ static void EmitUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo)
         if (ANI_ERROR == asyncCallbackInfo->vm->AttachCurrentThread(&aniArgs, ANI_VERSION_1, &env)) {
             if (ANI_OK != asyncCallbackInfo->vm->GetEnv(ANI_VERSION_1, &env)) {
                 SEN_HILOGE("GetEnv failed");
+                asyncCallbackInfo->taskPending.store(false);
                 return;
             }
         }
         asyncCallbackInfo->env = env;
-
-        AniLocalScopeGuard aniLocalScopeGuard(asyncCallbackInfo->env, ANI_SCOPE_SIZE);
-        if (!aniLocalScopeGuard.IsStatusOK()) {
-            SEN_HILOGE("CreateLocalScope failed");
-            return;
-        }
-
-        if (!(g_convertfuncList.find(asyncCallbackInfo->type) != g_convertfuncList.end())) {
-            SEN_HILOGE("asyncCallbackInfo type is invalid");
-            ThrowBusinessError(asyncCallbackInfo->env, EINVAL, "asyncCallbackInfo type is invalid");
-            return;
-        }
-        std::vector<ani_ref> args;
-        g_convertfuncList[asyncCallbackInfo->type](asyncCallbackInfo, args);
-
-        auto fnObj = reinterpret_cast<ani_fn_object>(asyncCallbackInfo->callback[0]);
-        SEN_HILOGD("Begin to call FunctionalObject_Call");
-        if (fnObj == nullptr) {
-            SEN_HILOGE("fnObj == nullptr");
-            ThrowBusinessError(asyncCallbackInfo->env, EINVAL, "fnObj == nullptr");
-            return;
-        }
-        if (IsInstanceOf(asyncCallbackInfo->env, "Lstd/core/Function1;", fnObj) == 0) {
-            SEN_HILOGE("fnObj is not instance Of function");
-            ThrowBusinessError(asyncCallbackInfo->env, EINVAL, "fnObj is not instance Of function");
-            return;
-        }
-
-        ani_ref result;
-        if (ANI_OK != asyncCallbackInfo->env->FunctionalObject_Call(fnObj, 1, args.data(), &result)) {
-            SEN_HILOGE("FunctionalObject_Call failed");
-            ThrowBusinessError(asyncCallbackInfo->env, EINVAL, "FunctionalObject_Call failed");
+        asyncCallbackInfo->taskPending.store(false);
+        bool latestOnly = !asyncCallbackInfo->isBatch && (asyncCallbackInfo->coalesceInterval > 0);
+        asyncCallbackInfo->deliverySamples.clear();
+        asyncCallbackInfo->readSeq = asyncCallbackInfo->staging->Collect(asyncCallbackInfo->readSeq, latestOnly,
+            asyncCallbackInfo->deliverySamples);
+        if (asyncCallbackInfo->deliverySamples.empty()) {
             return;
         }
-        SEN_HILOGD("FunctionalObject_Call success");
+        asyncCallbackInfo->lastDeliverTime.store(GetSteadyTime());
+        DeliverSamples(asyncCallbackInfo);
     };
-    if (!SendEventToMainThread(task)) {
+    if (!SendEventToMainThread(task, GetDeliverDelay(asyncCallbackInfo))) {
         SEN_HILOGE("failed to send event");
+        asyncCallbackInfo->taskPending.store(false);
     }
 }
+
 static void EmitOnCallback(SensorEvent *event)
 {
     CHKPV(event);
@@ -401,10 +462,18 @@ static void EmitOnCallback(SensorEvent *event)
         return;
     }
     std::lock_guard<std::mutex> onCallbackLock(onMutex_);
-    auto onCallbackInfos = g_onCallbackInfos[sensorTypeId];
+    auto stagingIter = g_stagingBuffers.find(sensorTypeId);
+    if (stagingIter == g_stagingBuffers.end() || stagingIter->second == nullptr) {
+        return;
+    }
+    if (!stagingIter->second->Push(*event)) {
+        SEN_HILOGE("Copy sensor data failed");
+        return;
+    }
+    auto &onCallbackInfos = g_onCallbackInfos[sensorTypeId];
     for (auto &onCallbackInfo : onCallbackInfos) {
-        if (!CopySensorData(onCallbackInfo, event)) {
-            SEN_HILOGE("Copy sensor data failed");
+        CHKPC(onCallbackInfo);
+        if (onCallbackInfo->taskPending.exchange(true)) {
             continue;
         }
         EmitUvEventLoop(onCallbackInfo);
@@ -437,7 +506,7 @@ static int32_t SubscribeSensor(int32_t sensorTypeId, int64_t interval, RecordSen
     return ActivateSensor(sensorTypeId, &user);
 }
 
-static bool IsSubscribed(ani_env *env, int32_t sensorTypeId, ani_object callback)
+static bool IsSubscribed(ani_env *env, int32_t sensorTypeId, ani_object callback, bool isBatch)
 {
     CALL_LOG_ENTER;
     if (auto iter = g_onCallbackInfos.find(sensorTypeId); iter == g_onCallbackInfos.end()) {
@@ -447,7 +516,7 @@ static bool IsSubscribed(ani_env *env, int32_t sensorTypeId, ani_object callback
     std::vector<sptr<AsyncCallbackInfo>> callbackInfos = g_onCallbackInfos[sensorTypeId];
     for (auto callbackInfo : callbackInfos) {
         CHKPC(callbackInfo);
-        if (callbackInfo->env != env) {
+        if ((callbackInfo->env != env) || (callbackInfo->isBatch != isBatch)) {
             continue;
         }
 
@@ -463,11 +532,12 @@ static bool IsSubscribed(ani_env *env, int32_t sensorTypeId, ani_object callback
     return false;
 }
 
-static void UpdateCallbackInfos(ani_env *env, int32_t sensorTypeId, ani_object callback)
+static void UpdateCallbackInfos(ani_env *env, int32_t sensorTypeId, ani_object callback, bool isBatch,
+    int64_t coalesceInterval)
 {
     CALL_LOG_ENTER;
     std::lock_guard<std::mutex> onCallbackLock(onMutex_);
-    CHKCV((!IsSubscribed(env, sensorTypeId, callback)), "The callback has been subscribed");
+    CHKCV((!IsSubscribed(env, sensorTypeId, callback, isBatch)), "The callback has been subscribed");
 
     ani_vm *vm = nullptr;
     if (ANI_OK != env->GetVM(&vm)) {
@@ -481,6 +551,15 @@ static void UpdateCallbackInfos(ani_env *env, int32_t sensorTypeId, ani_object c
         SEN_HILOGE("GlobalReference_Create failed");
         return;
     }
+    auto &staging = g_stagingBuffers[sensorTypeId];
+    if (staging == nullptr) {
+        staging = std::make_shared<SensorStagingBuffer>();
+    }
+    asyncCallbackInfo->staging = staging;
+    asyncCallbackInfo->readSeq = staging->GetWriteSeq();
+    asyncCallbackInfo->isBatch = isBatch;
+    asyncCallbackInfo->coalesceInterval = coalesceInterval;
+    asyncCallbackInfo->deliverySamples.reserve(isBatch ? STAGING_CAPACITY : 1);
 
     std::vector<sptr<AsyncCallbackInfo>> callbackInfos = g_onCallbackInfos[sensorTypeId];
     callbackInfos.push_back(asyncCallbackInfo);
@@ -545,9 +624,39 @@ static bool GetIntervalValue(ani_env *env, ani_object options, int64_t& interval
     return false;
 }
 
-static void On([[maybe_unused]] ani_env *env, ani_string typeId, ani_object callback, ani_object options)
+static bool GetCoalesceInterval(ani_env *env, ani_object options, int64_t &coalesceInterval)
+{
+    ani_boolean isUndefined;
+    env->Reference_IsUndefined(options, &isUndefined);
+    if (isUndefined) {
+        return true;
+    }
+    ani_ref coalesceRef;
+    if (ANI_OK != env->Object_GetPropertyByName_Ref(options, "coalesceInterval", &coalesceRef)) {
+        SEN_HILOGE("Failed to get property named coalesceInterval");
+        return false;
+    }
+    env->Reference_IsUndefined(coalesceRef, &isUndefined);
+    if (isUndefined) {
+        return true;
+    }
+    ani_double doubleValue;
+    if (ANI_OK != env->Object_CallMethodByName_Double(static_cast<ani_object>(coalesceRef), "unboxed",
+        nullptr, &doubleValue)) {
+        SEN_HILOGE("Failed to get coalesceInterval value");
+        return false;
+    }
+    if (doubleValue < 0) {
+        SEN_HILOGE("Invalid coalesceInterval");
+        return false;
+    }
+    coalesceInterval = static_cast<int64_t>(doubleValue);
+    return true;
+}
+
+static void SubscribeWithMode(ani_env *env, ani_string typeId, ani_object callback, ani_object options,
+    bool isBatch)
 {
-    CALL_LOG_ENTER;
     if (!IsInstanceOf(env, "Lstd/core/Function1;", callback)) {
         SEN_HILOGE("Wrong argument type");
         return;
@@ -565,22 +674,39 @@ static void On([[maybe_unused]] ani_env *env, ani_string typeId, ani_object call
     if (!GetIntervalValue(env, options, interval)) {
         SEN_HILOGW("Get interval failed");
     }
+    int64_t coalesceInterval = 0;
+    if (!GetCoalesceInterval(env, options, coalesceInterval)) {
+        ThrowBusinessError(env, PARAMETER_ERROR, "Invalid coalesceInterval");
+        return;
+    }
     int32_t ret = SubscribeSensor(sensorTypeId, interval, DataCallbackImpl);
     if (ret != ERR_OK) {
         ThrowBusinessError(env, ret, "SubscribeSensor fail");
         return;
     }
-    UpdateCallbackInfos(env, sensorTypeId, callback);
+    UpdateCallbackInfos(env, sensorTypeId, callback, isBatch, coalesceInterval);
+}
+
+static void On([[maybe_unused]] ani_env *env, ani_string typeId, ani_object callback, ani_object options)
+{
+    CALL_LOG_ENTER;
+    SubscribeWithMode(env, typeId, callback, options, false);
 }
 
-static int32_t RemoveAllCallback(ani_env *env, int32_t sensorTypeId)
+static void OnBatch([[maybe_unused]] ani_env *env, ani_string typeId, ani_object callback, ani_object options)
+{
+    CALL_LOG_ENTER;
+    SubscribeWithMode(env, typeId, callback, options, true);
+}
+
+static int32_t RemoveAllCallback(ani_env *env, int32_t sensorTypeId, bool isBatch)
 {
     CALL_LOG_ENTER;
     std::lock_guard<std::mutex> onCallbackLock(onMutex_);
     std::vector<sptr<AsyncCallbackInfo>> callbackInfos = g_onCallbackInfos[sensorTypeId];
     for (auto iter = callbackInfos.begin(); iter != callbackInfos.end();) {
         CHKPC(*iter);
-        if ((*iter)->env != env) {
+        if (((*iter)->env != env) || ((*iter)->isBatch != isBatch)) {
             ++iter;
             continue;
         }
@@ -589,20 +715,22 @@ static int32_t RemoveAllCallback(ani_env *env, int32_t sensorTypeId)
     if (callbackInfos.empty()) {
         SEN_HILOGD("No subscription to change sensor data");
         g_onCallbackInfos.erase(sensorTypeId);
+        g_stagingBuffers.erase(sensorTypeId);
         return 0;
     }
     g_onCallbackInfos[sensorTypeId] = callbackInfos;
     return callbackInfos.size();
 }
 
-static int32_t RemoveCallback(ani_env *env, int32_t sensorTypeId, ani_object callback)
+static int32_t RemoveCallback(ani_env *env, int32_t sensorTypeId, ani_object callback, bool isBatch)
 {
     CALL_LOG_ENTER;
     std::lock_guard<std::mutex> onCallbackLock(onMutex_);
     std::vector<sptr<AsyncCallbackInfo>> callbackInfos = g_onCallbackInfos[sensorTypeId];
     for (auto iter = callbackInfos.begin(); iter != callbackInfos.end();) {
         CHKPC(*iter);
-        if ((*iter)->env != env) {
+        if (((*iter)->env != env) || ((*iter)->isBatch != isBatch)) {
+            ++iter;
             continue;
         }
 
@@ -622,6 +750,7 @@ static int32_t RemoveCallback(ani_env *env, int32_t sensorTypeId, ani_object cal
     if (callbackInfos.empty()) {
         SEN_HILOGD("No subscription to change sensor data");
         g_onCallbackInfos.erase(sensorTypeId);
+        g_stagingBuffers.erase(sensorTypeId);
         return 0;
     }
     g_onCallbackInfos[sensorTypeId] = callbackInfos;
@@ -638,9 +767,8 @@ static int32_t UnsubscribeSensor(int32_t sensorTypeId)
     return UnsubscribeSensor(sensorTypeId, &user);
 }
 
-static void Off([[maybe_unused]] ani_env *env, ani_string type, ani_object callback)
+static void UnsubscribeWithMode(ani_env *env, ani_string type, ani_object callback, bool isBatch)
 {
-    CALL_LOG_ENTER;
     int32_t sensorTypeId = INVALID_SENSOR_ID;
     auto typeStr = AniStringUtils::ToStd(env, static_cast<ani_string>(type));
     if (stringToNumberMap.find(typeStr) == stringToNumberMap.end()) {
@@ -654,13 +782,13 @@ static void Off([[maybe_unused]] ani_env *env, ani_string type, ani_object callb
     ani_boolean isUndefined;
     env->Reference_IsUndefined(callback, &isUndefined);
     if (isUndefined) {
-        subscribeSize = RemoveAllCallback(env, sensorTypeId);
+        subscribeSize = RemoveAllCallback(env, sensorTypeId, isBatch);
     } else {
         ani_boolean result;
         if (env->Reference_IsNull(callback, &result) == ANI_OK && result) {
-            subscribeSize = RemoveAllCallback(env, sensorTypeId);
+            subscribeSize = RemoveAllCallback(env, sensorTypeId, isBatch);
         } else if (IsInstanceOf(env, "Lstd/core/Function1;", callback)) {
-            subscribeSize = RemoveCallback(env, sensorTypeId, callback);
+            subscribeSize = RemoveCallback(env, sensorTypeId, callback, isBatch);
         } else {
             ThrowBusinessError(env, PARAMETER_ERROR, "Invalid callback");
             return;
@@ -675,7 +803,18 @@ static void Off([[maybe_unused]] ani_env *env, ani_string type, ani_object callb
     if (ret == PARAMETER_ERROR || ret == PERMISSION_DENIED) {
         ThrowBusinessError(env, ret, "UnsubscribeSensor fail");
     }
-    return;
+}
+
+static void Off([[maybe_unused]] ani_env *env, ani_string type, ani_object callback)
+{
+    CALL_LOG_ENTER;
+    UnsubscribeWithMode(env, type, callback, false);
+}
+
+static void OffBatch([[maybe_unused]] ani_env *env, ani_string type, ani_object callback)
+{
+    CALL_LOG_ENTER;
+    UnsubscribeWithMode(env, type, callback, true);
 }
 
 ANI_EXPORT ani_status ANI_Constructor(ani_vm *vm, uint32_t *result)
@@ -695,7 +834,9 @@ ANI_EXPORT ani_status ANI_Constructor(ani_vm *vm, uint32_t *result)
 
     std::array methods = {
         ani_native_function {"on", nullptr, reinterpret_cast<void *>(On)},
+        ani_native_function {"onBatch", nullptr, reinterpret_cast<void *>(OnBatch)},
         ani_native_function {"off", nullptr, reinterpret_cast<void *>(Off)},
+        ani_native_function {"offBatch", nullptr, reinterpret_cast<void *>(OffBatch)},
     };
 
     if (ANI_OK != env->Namespace_BindNativeFunctions(ns, methods.data(), methods.size())) {
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensor_staging_buffer.h"
+
+#include <cinttypes>
+
+#include "securec.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorStagingBuffer"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+
+static bool CopySensorData(const SensorEvent &event, CallbackSensorData &sensorData)
+{
+    sensorData.sensorTypeId = event.sensorTypeId;
+    sensorData.dataLength = event.dataLen;
+    sensorData.timestamp = event.timestamp;
+    sensorData.sensorAccuracy = event.option;
+    CHKPF(event.data);
+    if (event.dataLen < sizeof(float)) {
+        SEN_HILOGE("Event dataLen less than float size");
+        return false;
+    }
+    if (memcpy_s(sensorData.data, sizeof(sensorData.data), event.data, event.dataLen) != EOK) {
+        SEN_HILOGE("Copy data failed");
+        return false;
+    }
+    return true;
+}
+
+bool SensorStagingBuffer::Push(const SensorEvent &event)
+{
+    std::lock_guard<std::mutex> stagingLock(mutex_);
+    if (!CopySensorData(event, samples_[writeSeq_ % STAGING_CAPACITY])) {
+        return false;
+    }
+    ++writeSeq_;
+    return true;
+}
+
+uint64_t SensorStagingBuffer::GetWriteSeq()
+{
+    std::lock_guard<std::mutex> stagingLock(mutex_);
+    return writeSeq_;
+}
+
+uint64_t SensorStagingBuffer::Collect(uint64_t readSeq, bool latestOnly, std::vector<CallbackSensorData> &samples)
+{
+    std::lock_guard<std::mutex> stagingLock(mutex_);
+    if (readSeq >= writeSeq_) {
+        return writeSeq_;
+    }
+    if (latestOnly) {
+        readSeq = writeSeq_ - 1;
+    } else if (writeSeq_ - readSeq > STAGING_CAPACITY) {
+        SEN_HILOGW("Staging buffer overrun, dropped:%{public}" PRIu64, writeSeq_ - readSeq - STAGING_CAPACITY);
+        readSeq = writeSeq_ - STAGING_CAPACITY;
+    }
+    for (; readSeq < writeSeq_; ++readSeq) {
+        samples.push_back(samples_[readSeq % STAGING_CAPACITY]);
+    }
+    return writeSeq_;
+}
+} // namespace Sensors
+} // namespace OHOS
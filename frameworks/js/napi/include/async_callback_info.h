@@ -14,12 +14,15 @@
  */
 #ifndef ASYNC_CALLBACK_INFO_H
 #define ASYNC_CALLBACK_INFO_H
+#include <memory>
+
 #include <uv.h>
 
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 #include "refbase.h"
 
+#include "raw_sensor_data_ring.h"
 #include "sensor_agent_type.h"
 #include "sensor_errors.h"
 #include "sensor_log.h"
@@ -56,6 +59,7 @@ enum CallbackDataType {
     SUBSCRIBE_COMPASS = 15,
     GET_BODY_STATE = 16,
     SENSOR_STATE_CHANGE = 17,
+    RAW_ON_CALLBACK = 18,
 };
 
 struct GeomagneticData {
@@ -112,6 +116,7 @@ public:
     CallbackDataType type;
     vector<SensorInfo> sensorInfos;
     SensorStatusEvent sensorStatusEvent;
+    std::shared_ptr<RawSensorDataRing> rawRing = nullptr;
     AsyncCallbackInfo(napi_env env, CallbackDataType type) : env(env), type(type) {}
     ~AsyncCallbackInfo()
     {
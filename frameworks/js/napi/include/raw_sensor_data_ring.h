@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAW_SENSOR_DATA_RING_H
+#define RAW_SENSOR_DATA_RING_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "sensor_agent_type.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr uint32_t RAW_RING_CAPACITY = 64;
+constexpr uint32_t RAW_SAMPLE_STRIDE = 16;
+
+/**
+ * Sample storage laid out for a single external ArrayBuffer. timestamps is placed first so that
+ * the BigInt64Array view starts 8-byte aligned and the Float32Array view follows it directly.
+ */
+struct RawSensorSamples {
+    int64_t timestamps[RAW_RING_CAPACITY];
+    float values[RAW_RING_CAPACITY * RAW_SAMPLE_STRIDE];
+};
+
+/**
+ * Single-producer ring for the raw JS subscription. The sensor callback thread pushes samples into
+ * storage that JS never sees, the JS thread copies the range published since its previous read into
+ * the staging buffer behind the typed array views. The copy is validated seqlock style against the
+ * producer, so a slot overwritten while it was being copied is reported as dropped instead of being
+ * delivered torn. Only one JS task is queued at a time, later samples are picked up by the task that
+ * is already pending.
+ */
+class RawSensorDataRing {
+public:
+    RawSensorDataRing() = default;
+    ~RawSensorDataRing() = default;
+    bool Push(const SensorEvent &event);
+    bool Acquire(uint32_t &index, uint32_t &count, uint32_t &dropped);
+    void CancelPending();
+    RawSensorSamples *GetSamples();
+
+private:
+    RawSensorSamples samples_ {};
+    RawSensorSamples staging_ {};
+    std::atomic<uint64_t> beginSeq_ { 0 };
+    std::atomic<uint64_t> writeSeq_ { 0 };
+    uint64_t readSeq_ { 0 };
+    std::atomic_bool pending_ { false };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // RAW_SENSOR_DATA_RING_H
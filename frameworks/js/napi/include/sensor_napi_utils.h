@@ -43,6 +43,8 @@ bool GetStringValue(const napi_env &env, const napi_value &value, string &result
 void EmitAsyncCallbackWork(sptr<AsyncCallbackInfo> asyncCallbackInfo);
 void EmitUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo, std::shared_ptr<CallbackSensorData> cb);
 void EmitPromiseWork(sptr<AsyncCallbackInfo> asyncCallbackInfo);
+bool CreateRawSensorViews(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo);
+void EmitRawUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo);
 bool ConvertToFailData(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo, napi_value result[2]);
 bool ConvertToGeomagneticData(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo, napi_value result[2]);
 bool ConvertToNumber(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo, napi_value result[2]);
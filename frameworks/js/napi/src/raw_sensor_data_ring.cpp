@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "raw_sensor_data_ring.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "securec.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "RawSensorDataRing"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+
+bool RawSensorDataRing::Push(const SensorEvent &event)
+{
+    CHKPF(event.data);
+    uint64_t seq = writeSeq_.load(std::memory_order_relaxed);
+    // Announce the slot before touching it, the reader discards any copy taken from it meanwhile
+    beginSeq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    uint32_t slot = static_cast<uint32_t>(seq % RAW_RING_CAPACITY);
+    float *values = &samples_.values[slot * RAW_SAMPLE_STRIDE];
+    size_t valuesSize = RAW_SAMPLE_STRIDE * sizeof(float);
+    size_t copySize = std::min(static_cast<size_t>(event.dataLen), valuesSize);
+    if (memset_s(values, valuesSize, 0, valuesSize) != EOK) {
+        SEN_HILOGE("memset_s failed");
+        return false;
+    }
+    if (copySize > 0 && memcpy_s(values, valuesSize, event.data, copySize) != EOK) {
+        SEN_HILOGE("memcpy_s failed");
+        return false;
+    }
+    samples_.timestamps[slot] = event.timestamp;
+    writeSeq_.store(seq + 1, std::memory_order_release);
+    return !pending_.exchange(true, std::memory_order_acq_rel);
+}
+
+bool RawSensorDataRing::Acquire(uint32_t &index, uint32_t &count, uint32_t &dropped)
+{
+    pending_.store(false, std::memory_order_release);
+    uint64_t writeSeq = writeSeq_.load(std::memory_order_acquire);
+    uint64_t firstSeq = readSeq_;
+    if (writeSeq - firstSeq > RAW_RING_CAPACITY) {
+        firstSeq = writeSeq - RAW_RING_CAPACITY;
+    }
+    for (uint64_t seq = firstSeq; seq < writeSeq; ++seq) {
+        uint32_t slot = static_cast<uint32_t>(seq % RAW_RING_CAPACITY);
+        staging_.timestamps[slot] = samples_.timestamps[slot];
+        std::copy_n(&samples_.values[slot * RAW_SAMPLE_STRIDE], RAW_SAMPLE_STRIDE,
+            &staging_.values[slot * RAW_SAMPLE_STRIDE]);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t beginSeq = beginSeq_.load(std::memory_order_relaxed);
+    // Samples whose slot the producer started to reuse during the copy may be torn
+    if (beginSeq > RAW_RING_CAPACITY && firstSeq < beginSeq - RAW_RING_CAPACITY) {
+        firstSeq = std::min(beginSeq - RAW_RING_CAPACITY, writeSeq);
+    }
+    uint64_t droppedSeq = firstSeq - readSeq_;
+    if (droppedSeq > 0) {
+        SEN_HILOGW("Raw ring overrun, dropped:%{public}" PRIu64, droppedSeq);
+    }
+    index = static_cast<uint32_t>(firstSeq % RAW_RING_CAPACITY);
+    count = static_cast<uint32_t>(writeSeq - firstSeq);
+    dropped = static_cast<uint32_t>(std::min<uint64_t>(droppedSeq, UINT32_MAX));
+    readSeq_ = writeSeq;
+    return (count > 0) || (dropped > 0);
+}
+
+void RawSensorDataRing::CancelPending()
+{
+    pending_.store(false, std::memory_order_release);
+}
+
+RawSensorSamples *RawSensorDataRing::GetSamples()
+{
+    return &staging_;
+}
+} // namespace Sensors
+} // namespace OHOS
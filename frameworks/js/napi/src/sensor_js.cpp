@@ -140,13 +140,24 @@ static void EmitOnCallback(SensorEvent *event)
         return;
     }
     std::lock_guard<std::mutex> onCallbackLock(g_onMutex);
-    std::shared_ptr<CallbackSensorData> cb = std::make_shared<CallbackSensorData>();
-    if (!CopySensorData(event, cb)) {
-        SEN_HILOGE("Copy sensor data failed");
-        return;
-    }
+    std::shared_ptr<CallbackSensorData> cb = nullptr;
     auto onCallbackInfos = g_onCallbackInfos[{event->deviceId, event->sensorTypeId, event->sensorId, event->location}];
     for (auto &onCallbackInfo : onCallbackInfos) {
+        CHKPC(onCallbackInfo);
+        if (onCallbackInfo->type == RAW_ON_CALLBACK) {
+            CHKPC(onCallbackInfo->rawRing);
+            if (onCallbackInfo->rawRing->Push(*event)) {
+                EmitRawUvEventLoop(onCallbackInfo);
+            }
+            continue;
+        }
+        if (cb == nullptr) {
+            cb = std::make_shared<CallbackSensorData>();
+            if (!CopySensorData(event, cb)) {
+                SEN_HILOGE("Copy sensor data failed");
+                return;
+            }
+        }
         EmitUvEventLoop(onCallbackInfo, cb);
     }
 }
@@ -434,21 +445,39 @@ static bool IsSubscribed(napi_env env, SensorDescription sensorDesc, napi_value
     return false;
 }
 
-static void UpdateCallbackInfos(napi_env env, SensorDescription sensorDesc, napi_value callback)
+static bool UpdateCallbackInfos(napi_env env, SensorDescription sensorDesc, napi_value callback, bool isRaw)
 {
     CALL_LOG_ENTER;
     std::lock_guard<std::mutex> onCallbackLock(g_onMutex);
-    CHKCV((!IsSubscribed(env, sensorDesc, callback)), "The callback has been subscribed");
-    sptr<AsyncCallbackInfo> asyncCallbackInfo = new (std::nothrow) AsyncCallbackInfo(env, ON_CALLBACK);
-    CHKPV(asyncCallbackInfo);
+    if (IsSubscribed(env, sensorDesc, callback)) {
+        SEN_HILOGW("The callback has been subscribed");
+        return true;
+    }
+    sptr<AsyncCallbackInfo> asyncCallbackInfo =
+        new (std::nothrow) AsyncCallbackInfo(env, isRaw ? RAW_ON_CALLBACK : ON_CALLBACK);
+    CHKPF(asyncCallbackInfo);
     napi_status status = napi_create_reference(env, callback, 1, &asyncCallbackInfo->callback[0]);
     if (status != napi_ok) {
         ThrowErr(env, PARAMETER_ERROR, "napi_create_reference fail");
-        return;
+        return false;
+    }
+    if (isRaw) {
+        asyncCallbackInfo->rawRing = std::make_shared<RawSensorDataRing>();
+        if (!CreateRawSensorViews(env, asyncCallbackInfo)) {
+            ThrowErr(env, PARAMETER_ERROR, "Create raw sensor views fail");
+            return false;
+        }
     }
     std::vector<sptr<AsyncCallbackInfo>> callbackInfos = g_onCallbackInfos[sensorDesc];
     callbackInfos.push_back(asyncCallbackInfo);
     g_onCallbackInfos[sensorDesc] = callbackInfos;
+    return true;
+}
+
+static bool CheckOnceSubscribe(SensorDescription sensorDesc)
+{
+    std::lock_guard<std::mutex> onceCallbackLock(g_onceMutex);
+    return g_onceCallbackInfos.find(sensorDesc) != g_onceCallbackInfos.end();
 }
 
 static bool GetInterval(napi_env env, napi_value value, int64_t &interval)
@@ -479,6 +508,20 @@ static bool GetInterval(napi_env env, napi_value value, int64_t &interval)
     return true;
 }
 
+static bool IsRawMode(napi_env env, size_t argc, napi_value value)
+{
+    if (argc < ARGC_NUM_THREE || !IsMatchType(env, value, napi_object)) {
+        return false;
+    }
+    napi_value napiRaw = GetNamedProperty(env, value, "raw");
+    if (napiRaw == nullptr || !IsMatchType(env, napiRaw, napi_boolean)) {
+        return false;
+    }
+    bool isRaw = false;
+    CHKNRF(env, napi_get_value_bool(env, napiRaw, &isRaw), "napi_get_value_bool");
+    return isRaw;
+}
+
 static bool IsPlugSubscribed(napi_env env, napi_value callback)
 {
     CALL_LOG_ENTER;
@@ -630,7 +673,16 @@ static napi_value On(napi_env env, napi_callback_info info)
         ThrowErr(env, ret, "SubscribeSensor fail");
         return nullptr;
     }
-    UpdateCallbackInfos(env, sensorDesc, args[1]);
+    if (UpdateCallbackInfos(env, sensorDesc, args[1], IsRawMode(env, argc, args[ARGS_NUM_TWO]))) {
+        return nullptr;
+    }
+    if (CheckSubscribe(sensorDesc) || CheckSystemSubscribe(sensorDesc) || CheckOnceSubscribe(sensorDesc)) {
+        SEN_HILOGW("There are other callbacks of the sensor, not need unsubscribe");
+        return nullptr;
+    }
+    if (UnsubscribeSensor(sensorDesc) != ERR_OK) {
+        SEN_HILOGE("Roll back subscription failed");
+    }
     return nullptr;
 }
 
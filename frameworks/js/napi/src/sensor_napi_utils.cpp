@@ -15,6 +15,7 @@
 
 #include "sensor_napi_utils.h"
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
@@ -31,6 +32,9 @@ namespace Sensors {
 namespace {
 constexpr int32_t STRING_LENGTH_MAX = 64;
 constexpr int32_t RESULT_SIZE = 2;
+constexpr size_t RAW_CALLBACK_ARGC = 5;
+constexpr int32_t RAW_VALUES_REF = 1;
+constexpr int32_t RAW_TIMESTAMPS_REF = 2;
 } // namespace
 static std::mutex g_sensorAttrListMutex;
 bool IsSameValue(const napi_env &env, const napi_value &lhs, const napi_value &rhs)
@@ -630,6 +634,102 @@ void EmitUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo, std::shared_ptr<
     }
 }
 
+static void FinalizeRawSensorSamples(napi_env env, void *data, void *hint)
+{
+    auto holder = reinterpret_cast<std::shared_ptr<RawSensorDataRing> *>(hint);
+    delete holder;
+}
+
+bool CreateRawSensorViews(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo)
+{
+    CALL_LOG_ENTER;
+    CHKPF(asyncCallbackInfo);
+    CHKPF(asyncCallbackInfo->rawRing);
+    RawSensorSamples *samples = asyncCallbackInfo->rawRing->GetSamples();
+    CHKPF(samples);
+    /**
+     * The ArrayBuffer keeps its own reference to the ring, so views retained by JS after off()
+     * never point to freed memory.
+     */
+    auto holder = new (std::nothrow) std::shared_ptr<RawSensorDataRing>(asyncCallbackInfo->rawRing);
+    CHKPF(holder);
+    napi_value arrayBuffer = nullptr;
+    if (napi_create_external_arraybuffer(env, samples, sizeof(RawSensorSamples), FinalizeRawSensorSamples,
+        holder, &arrayBuffer) != napi_ok) {
+        SEN_HILOGE("napi_create_external_arraybuffer fail");
+        delete holder;
+        return false;
+    }
+    napi_value values = nullptr;
+    CHKNRF(env, napi_create_typedarray(env, napi_float32_array, RAW_RING_CAPACITY * RAW_SAMPLE_STRIDE,
+        arrayBuffer, offsetof(RawSensorSamples, values), &values), "napi_create_typedarray");
+    napi_value timestamps = nullptr;
+    CHKNRF(env, napi_create_typedarray(env, napi_bigint64_array, RAW_RING_CAPACITY,
+        arrayBuffer, offsetof(RawSensorSamples, timestamps), &timestamps), "napi_create_typedarray");
+    CHKNRF(env, napi_create_reference(env, values, 1, &asyncCallbackInfo->callback[RAW_VALUES_REF]),
+        "napi_create_reference");
+    CHKNRF(env, napi_create_reference(env, timestamps, 1, &asyncCallbackInfo->callback[RAW_TIMESTAMPS_REF]),
+        "napi_create_reference");
+    return true;
+}
+
+static bool GetRawCallbackArgs(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo, uint32_t index,
+    uint32_t count, uint32_t dropped, napi_value argv[RAW_CALLBACK_ARGC])
+{
+    CHKNRF(env, napi_get_reference_value(env, asyncCallbackInfo->callback[RAW_VALUES_REF], &argv[0]),
+        "napi_get_reference_value");
+    CHKNRF(env, napi_get_reference_value(env, asyncCallbackInfo->callback[RAW_TIMESTAMPS_REF], &argv[1]),
+        "napi_get_reference_value");
+    CHKNRF(env, napi_create_uint32(env, index, &argv[2]), "napi_create_uint32");
+    CHKNRF(env, napi_create_uint32(env, count, &argv[3]), "napi_create_uint32");
+    CHKNRF(env, napi_create_uint32(env, dropped, &argv[4]), "napi_create_uint32");
+    return true;
+}
+
+void EmitRawUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo)
+{
+    CHKPV(asyncCallbackInfo);
+    CHKPV(asyncCallbackInfo->rawRing);
+    asyncCallbackInfo->IncStrongRef(nullptr);
+    auto event = asyncCallbackInfo.GetRefPtr();
+    auto task = [event]() {
+        sptr<AsyncCallbackInfo> asyncCallbackInfo(static_cast<AsyncCallbackInfo *>(event));
+        asyncCallbackInfo->DecStrongRef(nullptr);
+        uint32_t index = 0;
+        uint32_t count = 0;
+        uint32_t dropped = 0;
+        if (!asyncCallbackInfo->rawRing->Acquire(index, count, dropped)) {
+            return;
+        }
+        napi_env env = asyncCallbackInfo->env;
+        napi_handle_scope scope = nullptr;
+        napi_open_handle_scope(env, &scope);
+        if (scope == nullptr) {
+            SEN_HILOGE("napi_handle_scope is nullptr");
+            return;
+        }
+        napi_value callback = nullptr;
+        napi_value argv[RAW_CALLBACK_ARGC] = { 0 };
+        if (napi_get_reference_value(env, asyncCallbackInfo->callback[0], &callback) != napi_ok ||
+            !GetRawCallbackArgs(env, asyncCallbackInfo, index, count, dropped, argv)) {
+            SEN_HILOGE("Get raw callback arguments fail");
+            napi_close_handle_scope(env, scope);
+            return;
+        }
+        napi_value callResult = nullptr;
+        if (napi_call_function(env, nullptr, callback, RAW_CALLBACK_ARGC, argv, &callResult) != napi_ok) {
+            SEN_HILOGE("napi_call_function callback fail");
+        }
+        napi_close_handle_scope(env, scope);
+    };
+    auto ret = napi_send_event(asyncCallbackInfo->env, task, napi_eprio_immediate);
+    if (ret != napi_ok) {
+        SEN_HILOGE("Failed to SendEvent, ret:%{public}d", ret);
+        asyncCallbackInfo->rawRing->CancelPending();
+        asyncCallbackInfo->DecStrongRef(nullptr);
+    }
+}
+
 void EmitPromiseWork(sptr<AsyncCallbackInfo> asyncCallbackInfo)
 {
     CALL_LOG_ENTER;
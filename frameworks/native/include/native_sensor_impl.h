@@ -16,6 +16,9 @@
 #ifndef NATIVE_SENSOR_IMPL
 #define NATIVE_SENSOR_IMPL
 
+#include <atomic>
+#include <memory>
+
 #include "oh_sensor.h"
 #include "sensor_agent_type.h"
 
@@ -57,5 +60,21 @@ struct Sensor_Event {
     uint8_t *data = nullptr;
     uint32_t dataLen = 0;
 };
+
+/**
+ * Single-producer single-consumer ring of a pull-mode subscription. The sensor callback thread only
+ * advances writeSeq, the polling thread only advances readSeq, so neither side takes a lock.
+ */
+struct Sensor_PollSubscription {
+    int32_t sensorType = -1;
+    int64_t samplingInterval = -1;
+    uint32_t capacity = 0;
+    std::unique_ptr<Sensor_Event[]> events;
+    std::unique_ptr<uint8_t[]> data;
+    std::atomic<uint64_t> writeSeq { 0 };
+    std::atomic<uint64_t> readSeq { 0 };
+    std::atomic<uint64_t> droppedCount { 0 };
+    uint32_t inFlight = 0;
+};
 #endif // NATIVE_SENSOR_IMPL
 
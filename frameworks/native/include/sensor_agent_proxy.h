@@ -36,6 +36,7 @@ public:
     int32_t DeactivateSensor(const SensorDescription &sensorDesc, const SensorUser *user);
     int32_t SetBatch(const SensorDescription &sensorDesc, const SensorUser *user, int64_t samplingInterval,
         int64_t reportInterval);
+    int32_t SetCoalesceWindow(const SensorDescription &sensorDesc, const SensorUser *user, int64_t windowNs);
     int32_t SubscribeSensor(const SensorDescription &sensorDesc, const SensorUser *user);
     int32_t UnsubscribeSensor(const SensorDescription &sensorDesc, const SensorUser *user);
     int32_t SetMode(const SensorDescription &sensorDesc, const SensorUser *user, int32_t mode);
@@ -46,6 +47,8 @@ public:
     int32_t GetLocalDeviceId(int32_t &deviceId) const;
     int32_t SuspendSensors(int32_t pid);
     int32_t ResumeSensors(int32_t pid);
+    int32_t SuspendSensorsBatch(const int32_t *pids, int32_t count);
+    int32_t ResumeSensorsBatch(const int32_t *pids, int32_t count);
     int32_t GetSensorActiveInfos(int32_t pid, SensorActiveInfo **sensorActiveInfos, int32_t *count) const;
     int32_t Register(SensorActiveInfoCB callback);
     int32_t Unregister(SensorActiveInfoCB callback);
@@ -55,6 +58,9 @@ public:
     int32_t SubscribeSensorPlug(const SensorUser *user);
     int32_t UnsubscribeSensorPlug(const SensorUser *user);
     bool HandlePlugSensorData(const SensorPlugData &info);
+    int32_t SetBusyPollWindow(int64_t windowUs);
+    int32_t GetBusyPollStats(BusyPollStats &stats);
+    int32_t GetLostEventCount(uint64_t &count);
 
 private:
     int32_t CreateSensorDataChannel();
@@ -16,6 +16,7 @@
 #ifndef SENSOR_DATA_CHANNEL_H
 #define SENSOR_DATA_CHANNEL_H
 
+#include <atomic>
 #include <unordered_set>
 
 #include "sensor_agent_type.h"
@@ -27,6 +28,8 @@ namespace Sensors {
 using DataChannelCB = std::function<void(SensorEvent *, int32_t, void *)>;
 using ReceiveMessageFun = std::function<void(const char *, size_t)>;
 using DisconnectFun = std::function<void()>;
+constexpr int64_t MAX_BUSY_POLL_WINDOW_US = 1000;
+
 class SensorDataChannel : public SensorBasicDataChannel {
 public:
     SensorDataChannel() = default;
@@ -40,6 +43,9 @@ public:
     int32_t DelFdListener(int32_t fd);
     ReceiveMessageFun GetReceiveMessageFun() const;
     DisconnectFun GetDisconnectFun() const;
+    void SetBusyPollWindow(int64_t windowUs);
+    BusyPollStats GetBusyPollStats();
+    void BusyPoll(const std::function<void()> &receive);
 
 private:
     int32_t InnerSensorDataChannel();
@@ -48,6 +54,11 @@ private:
     std::unordered_set<int32_t> listenedFdSet_;
     ReceiveMessageFun receiveMessage_;
     DisconnectFun disconnect_;
+    // Busy polling stays off until SetBusyPollWindow is called with a non-zero window
+    std::atomic<int64_t> maxBusyPollWindowNs_ { 0 };
+    int64_t busyPollWindowNs_ { 0 };
+    std::mutex busyPollMutex_;
+    BusyPollStats busyPollStats_;
 };
 } // namespace Sensors
 } // namespace OHOS
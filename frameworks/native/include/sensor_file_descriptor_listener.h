@@ -16,6 +16,10 @@
 #ifndef SENSOR_FILE_DESCRIPTOR_LISTENER_H
 #define SENSOR_FILE_DESCRIPTOR_LISTENER_H
 
+#include <array>
+#include <bitset>
+
+#include "compact_sensor_event.h"
 #include "sensor_data_channel.h"
 
 namespace OHOS {
@@ -30,8 +34,18 @@ public:
     void ExcuteCallback(int32_t length);
 
 private:
+    bool DecodeSensorRecord(const char *buf, size_t size, size_t &offset);
+    bool DecodeEventRecord(const char *buf, size_t size, size_t &offset);
+    bool DecodeGapRecord(const char *buf, size_t size, size_t &offset);
+    void DropRemainingEvents(const char *buf, size_t size, size_t offset);
+    void ReturnCredit();
     SensorDataChannel *channel_ = nullptr;
     SensorData *receiveDataBuff_ = nullptr;
+    SensorData eventData_ {};
+    std::array<CompactSensorRecord, MAX_COMPACT_HANDLE_COUNT> sensorRecords_ {};
+    std::bitset<MAX_COMPACT_HANDLE_COUNT> validHandles_;
+    uint64_t lostCount_ = 0;
+    uint32_t consumedCount_ = 0;
 };
 } // namespace Sensors
 } // namespace OHOS
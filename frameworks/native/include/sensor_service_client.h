@@ -23,6 +23,7 @@
 #include "system_ability_load_callback_stub.h"
 
 #include "sensor_basic_info.h"
+#include "sensor_catalog.h"
 #include "sensor_client_stub.h"
 #include "sensor_data_channel.h"
 #include "sensor_service_proxy.h"
@@ -38,12 +39,17 @@ public:
     int32_t GetSensorListByDevice(int32_t deviceId, std::vector<Sensor> &singleDevSensors);
     int32_t EnableSensor(const SensorDescription &sensorDesc, int64_t samplingPeriod, int64_t maxReportDelay);
     int32_t DisableSensor(const SensorDescription &sensorDesc);
+    int32_t SetCoalesceWindow(const SensorDescription &sensorDesc, int64_t windowNs);
+    int32_t EnableSensors(const std::vector<SensorEnableInfoIPC> &enableInfos, std::vector<int32_t> &results);
+    int32_t DisableSensors(const std::vector<SensorDescription> &sensorDescs, std::vector<int32_t> &results);
     int32_t TransferDataChannel(sptr<SensorDataChannel> sensorDataChannel);
     int32_t DestroyDataChannel();
     void ProcessDeathObserver(const wptr<IRemoteObject> &object);
     bool IsValid(const SensorDescription &sensorDesc);
     int32_t SuspendSensors(int32_t pid);
     int32_t ResumeSensors(int32_t pid);
+    int32_t SuspendSensorsBatch(const std::vector<int32_t> &pids);
+    int32_t ResumeSensorsBatch(const std::vector<int32_t> &pids);
     int32_t GetActiveInfoList(int32_t pid, std::vector<ActiveInfo> &activeInfoList);
     int32_t Register(SensorActiveInfoCB callback, sptr<SensorDataChannel> sensorDataChannel);
     int32_t Unregister(SensorActiveInfoCB callback);
@@ -65,14 +71,20 @@ private:
     int32_t CreateSocketClientFd(int32_t &clientFd);
     int32_t CreateSocketChannel();
     void ReenableSensor();
+    int32_t RestoreSensors(sptr<ISensorService> sensorServer, const std::vector<SensorEnableInfoIPC> &enableInfos);
+    void RestoreCoalesceWindows(sptr<ISensorService> sensorServer,
+        const std::map<SensorDescription, int64_t> &coalesceWindows);
     void WriteHiSysIPCEvent(ISensorServiceIpcCode code, int32_t ret);
     void WriteHiSysIPCEventSplit(ISensorServiceIpcCode code, int32_t ret);
     int32_t DealAfterServiceAlive();
+    int32_t LoadSensorList();
     bool LoadSensorService();
     std::mutex clientMutex_;
     sptr<IRemoteObject::DeathRecipient> serviceDeathObserver_ = nullptr;
     sptr<ISensorService> sensorServer_ = nullptr;
     std::vector<Sensor> sensorList_;
+    uint64_t catalogGeneration_ = 0;
+    SensorCatalogView catalogView_;
     std::mutex channelMutex_;
     sptr<SensorDataChannel> dataChannel_ = nullptr;
     sptr<SensorClientStub> sensorClientStub_ = nullptr;
@@ -15,10 +15,16 @@
 
 #include "oh_sensor.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "isensor_service.h"
 #include "native_sensor_impl.h"
 #include "securec.h"
 #include "sensor_agent.h"
+#include "sensor_data_event.h"
 #include "sensor_errors.h"
 
 #undef LOG_TAG
@@ -26,7 +32,25 @@
 
 namespace {
 const uint32_t FLOAT_SIZE = 4;
-}
+const uint32_t POLL_CAPACITY_MIN = 16;
+const uint32_t POLL_CAPACITY_MAX = 4096;
+
+struct PollSensorGroup {
+    SensorUser user {};
+    int64_t samplingInterval = -1;
+    std::vector<Sensor_PollSubscription *> subscriptions;
+};
+
+std::mutex g_pollSubscribeMutex;
+/**
+ * Guards g_pollGroups and every subscription list. The data callback holds it only for a map lookup and
+ * fixed-size copies into the rings, the API paths hold it only to edit a list and never across an IPC
+ * (g_pollSubscribeMutex serializes those). Holding it in the callback is what guarantees that a
+ * subscription removed by OH_Sensor_DestroyPollSubscription is no longer written when it is deleted.
+ */
+std::mutex g_pollGroupMutex;
+std::map<int32_t, std::unique_ptr<PollSensorGroup>> g_pollGroups;
+} // namespace
 
 Sensor_Result OH_Sensor_GetInfos(Sensor_Info **sensors, uint32_t *count)
 {
@@ -365,4 +389,231 @@ int32_t OH_Sensor_DestroySubscriber(Sensor_Subscriber *user)
     delete user;
     user = nullptr;
     return SENSOR_SUCCESS;
-}
\ No newline at end of file
+}
+static void PushPollEvent(Sensor_PollSubscription *subscription, const SensorEvent &event)
+{
+    uint64_t writeSeq = subscription->writeSeq.load(std::memory_order_relaxed);
+    uint64_t readSeq = subscription->readSeq.load(std::memory_order_acquire);
+    if (writeSeq - readSeq >= subscription->capacity) {
+        subscription->droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    uint32_t slot = static_cast<uint32_t>(writeSeq & (subscription->capacity - 1));
+    uint8_t *data = subscription->data.get() + static_cast<size_t>(slot) * OHOS::Sensors::SENSOR_MAX_LENGTH;
+    uint32_t dataLen = std::min(event.dataLen, static_cast<uint32_t>(OHOS::Sensors::SENSOR_MAX_LENGTH));
+    if (dataLen > 0 && memcpy_s(data, OHOS::Sensors::SENSOR_MAX_LENGTH, event.data, dataLen) != EOK) {
+        SEN_HILOGE("memcpy_s failed");
+        return;
+    }
+    Sensor_Event &pollEvent = subscription->events[slot];
+    pollEvent.sensorTypeId = event.sensorTypeId;
+    pollEvent.version = event.version;
+    pollEvent.timestamp = event.timestamp;
+    pollEvent.option = event.option;
+    pollEvent.mode = event.mode;
+    pollEvent.data = data;
+    pollEvent.dataLen = dataLen;
+    subscription->writeSeq.store(writeSeq + 1, std::memory_order_release);
+}
+
+static void PollDataCallback(SensorEvent *event)
+{
+    if (event == nullptr || event->data == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> groupLock(g_pollGroupMutex);
+    auto iter = g_pollGroups.find(event->sensorTypeId);
+    if (iter == g_pollGroups.end()) {
+        return;
+    }
+    for (auto subscription : iter->second->subscriptions) {
+        PushPollEvent(subscription, *event);
+    }
+}
+
+static uint32_t GetPollCapacity(uint32_t capacity)
+{
+    uint32_t result = POLL_CAPACITY_MIN;
+    while (result < capacity && result < POLL_CAPACITY_MAX) {
+        result <<= 1;
+    }
+    return result;
+}
+
+static Sensor_Result ActivatePollGroup(int32_t sensorType, SensorUser *user, int64_t samplingInterval)
+{
+    int32_t ret = SubscribeSensor(sensorType, user);
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("SubscribeSensor failed, %{public}d", ret);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    ret = SetBatch(sensorType, user, samplingInterval, samplingInterval);
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("SetBatch failed, %{public}d", ret);
+        UnsubscribeSensor(sensorType, user);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    ret = ActivateSensor(sensorType, user);
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("ActivateSensor failed, %{public}d", ret);
+        UnsubscribeSensor(sensorType, user);
+        return static_cast<Sensor_Result>(ret);
+    }
+    return SENSOR_SUCCESS;
+}
+
+static Sensor_Result AddPollSubscription(Sensor_PollSubscription *subscription)
+{
+    std::lock_guard<std::mutex> subscribeLock(g_pollSubscribeMutex);
+    int32_t sensorType = subscription->sensorType;
+    SensorUser *user = nullptr;
+    bool isNewGroup = false;
+    bool needSetBatch = false;
+    {
+        std::lock_guard<std::mutex> groupLock(g_pollGroupMutex);
+        auto &group = g_pollGroups[sensorType];
+        if (group == nullptr) {
+            group = std::make_unique<PollSensorGroup>();
+            group->user.callback = PollDataCallback;
+            group->samplingInterval = subscription->samplingInterval;
+            isNewGroup = true;
+        } else if (subscription->samplingInterval < group->samplingInterval) {
+            group->samplingInterval = subscription->samplingInterval;
+            needSetBatch = true;
+        }
+        group->subscriptions.push_back(subscription);
+        user = &group->user;
+    }
+    Sensor_Result ret = SENSOR_SUCCESS;
+    if (isNewGroup) {
+        ret = ActivatePollGroup(sensorType, user, subscription->samplingInterval);
+    } else if (needSetBatch &&
+        SetBatch(sensorType, user, subscription->samplingInterval, subscription->samplingInterval) != SENSOR_SUCCESS) {
+        SEN_HILOGE("SetBatch failed");
+        ret = SENSOR_SERVICE_EXCEPTION;
+    }
+    if (ret != SENSOR_SUCCESS) {
+        std::lock_guard<std::mutex> groupLock(g_pollGroupMutex);
+        auto &subscriptions = g_pollGroups[sensorType]->subscriptions;
+        subscriptions.erase(std::remove(subscriptions.begin(), subscriptions.end(), subscription),
+            subscriptions.end());
+        if (subscriptions.empty()) {
+            g_pollGroups.erase(sensorType);
+        }
+    }
+    return ret;
+}
+
+Sensor_Result OH_Sensor_CreatePollSubscription(const Sensor_SubscriptionId *id,
+    const Sensor_SubscriptionAttribute *attribute, uint32_t capacity, Sensor_PollSubscription **subscription)
+{
+    if (id == nullptr || attribute == nullptr || subscription == nullptr || capacity == 0 ||
+        attribute->samplingInterval < 0) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    auto pollSubscription = std::make_unique<Sensor_PollSubscription>();
+    pollSubscription->sensorType = id->sensorType;
+    pollSubscription->samplingInterval = attribute->samplingInterval;
+    pollSubscription->capacity = GetPollCapacity(capacity);
+    pollSubscription->events = std::make_unique<Sensor_Event[]>(pollSubscription->capacity);
+    pollSubscription->data = std::make_unique<uint8_t[]>(
+        static_cast<size_t>(pollSubscription->capacity) * OHOS::Sensors::SENSOR_MAX_LENGTH);
+    Sensor_Result ret = AddPollSubscription(pollSubscription.get());
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("AddPollSubscription failed, %{public}d", ret);
+        return ret;
+    }
+    *subscription = pollSubscription.release();
+    return SENSOR_SUCCESS;
+}
+
+Sensor_Result OH_Sensor_Poll(Sensor_PollSubscription *subscription, Sensor_Event **events, uint32_t maxCount,
+    uint32_t *count)
+{
+    if (subscription == nullptr || events == nullptr || count == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    uint64_t readSeq = subscription->readSeq.load(std::memory_order_relaxed) + subscription->inFlight;
+    subscription->readSeq.store(readSeq, std::memory_order_release);
+    uint64_t writeSeq = subscription->writeSeq.load(std::memory_order_acquire);
+    uint32_t available = static_cast<uint32_t>(std::min(writeSeq - readSeq, static_cast<uint64_t>(maxCount)));
+    for (uint32_t i = 0; i < available; ++i) {
+        events[i] = &subscription->events[(readSeq + i) & (subscription->capacity - 1)];
+    }
+    subscription->inFlight = available;
+    *count = available;
+    return SENSOR_SUCCESS;
+}
+
+Sensor_Result OH_Sensor_GetPollDroppedCount(Sensor_PollSubscription *subscription, uint64_t *droppedCount)
+{
+    if (subscription == nullptr || droppedCount == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    *droppedCount = subscription->droppedCount.load(std::memory_order_relaxed);
+    return SENSOR_SUCCESS;
+}
+
+Sensor_Result OH_Sensor_DestroyPollSubscription(Sensor_PollSubscription *subscription)
+{
+    if (subscription == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    std::lock_guard<std::mutex> subscribeLock(g_pollSubscribeMutex);
+    int32_t sensorType = subscription->sensorType;
+    std::unique_ptr<PollSensorGroup> removedGroup = nullptr;
+    SensorUser *user = nullptr;
+    int64_t samplingInterval = -1;
+    {
+        std::lock_guard<std::mutex> groupLock(g_pollGroupMutex);
+        auto iter = g_pollGroups.find(sensorType);
+        if (iter == g_pollGroups.end()) {
+            SEN_HILOGE("Poll subscription not found");
+            return SENSOR_PARAMETER_ERROR;
+        }
+        auto &subscriptions = iter->second->subscriptions;
+        subscriptions.erase(std::remove(subscriptions.begin(), subscriptions.end(), subscription),
+            subscriptions.end());
+        if (subscriptions.empty()) {
+            removedGroup = std::move(iter->second);
+            g_pollGroups.erase(iter);
+        } else {
+            auto fastest = std::min_element(subscriptions.begin(), subscriptions.end(),
+                [](const Sensor_PollSubscription *lhs, const Sensor_PollSubscription *rhs) {
+                    return lhs->samplingInterval < rhs->samplingInterval;
+                });
+            if ((*fastest)->samplingInterval != iter->second->samplingInterval) {
+                iter->second->samplingInterval = (*fastest)->samplingInterval;
+                samplingInterval = iter->second->samplingInterval;
+                user = &iter->second->user;
+            }
+        }
+    }
+    delete subscription;
+    if (user != nullptr) {
+        // The remaining subscriptions no longer need the rate of the removed one
+        if (SetBatch(sensorType, user, samplingInterval, samplingInterval) != SENSOR_SUCCESS) {
+            SEN_HILOGE("SetBatch failed");
+            return SENSOR_SERVICE_EXCEPTION;
+        }
+        return SENSOR_SUCCESS;
+    }
+    if (removedGroup == nullptr) {
+        return SENSOR_SUCCESS;
+    }
+    int32_t ret = DeactivateSensor(sensorType, &removedGroup->user);
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("DeactivateSensor failed, %{public}d", ret);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    ret = UnsubscribeSensor(sensorType, &removedGroup->user);
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("UnsubscribeSensor failed, %{public}d", ret);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    return SENSOR_SUCCESS;
+}
@@ -174,6 +174,26 @@ int32_t ResumeSensors(int32_t pid)
     return ret;
 }
 
+int32_t SuspendSensorsBatch(const int32_t *pids, int32_t count)
+{
+    int32_t ret = SENSOR_AGENT_IMPL->SuspendSensorsBatch(pids, count);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGD("Suspend sensors batch failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t ResumeSensorsBatch(const int32_t *pids, int32_t count)
+{
+    int32_t ret = SENSOR_AGENT_IMPL->ResumeSensorsBatch(pids, count);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGD("Resume sensors batch failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
 int32_t GetActiveSensorInfos(int32_t pid, SensorActiveInfo **sensorActiveInfos, int32_t *count)
 {
     CHKPR(sensorActiveInfos, OHOS::Sensors::ERROR);
@@ -301,4 +321,52 @@ int32_t UnsubscribeSensorPlug(const SensorUser *user)
         return NormalizeErrCode(ret);
     }
     return ret;
+}
+
+int32_t SetBusyPollWindow(int64_t windowUs)
+{
+    int32_t ret = SENSOR_AGENT_IMPL->SetBusyPollWindow(windowUs);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("SetBusyPollWindow failed");
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t GetBusyPollStats(BusyPollStats *stats)
+{
+    CHKPR(stats, OHOS::Sensors::ERROR);
+    int32_t ret = SENSOR_AGENT_IMPL->GetBusyPollStats(*stats);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("GetBusyPollStats failed");
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t SetCoalesceWindow(int32_t sensorId, const SensorUser *user, int64_t windowNs)
+{
+    int32_t deviceId;
+    if (SENSOR_AGENT_IMPL->GetLocalDeviceId(deviceId) != OHOS::ERR_OK) {
+        SEN_HILOGW("The local deviceId cannot be found");
+        deviceId = DEFAULT_DEVICE_ID;
+    }
+    int32_t ret = SENSOR_AGENT_IMPL->SetCoalesceWindow({deviceId, sensorId, DEFAULT_SENSOR_ID, DEFAULT_LOCATION},
+        user, windowNs);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("SetCoalesceWindow failed");
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t GetLostEventCount(uint64_t *count)
+{
+    CHKPR(count, OHOS::Sensors::ERROR);
+    int32_t ret = SENSOR_AGENT_IMPL->GetLostEventCount(*count);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("GetLostEventCount failed");
+        return NormalizeErrCode(ret);
+    }
+    return ret;
 }
\ No newline at end of file
@@ -15,6 +15,9 @@
 
 #include "sensor_agent_proxy.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 #include "print_sensor_data.h"
 #include "sensor_service_client.h"
 #include "sensor_xcollie.h"
@@ -281,6 +284,30 @@ int32_t SensorAgentProxy::SetBatch(const SensorDescription &sensorDesc, const Se
     return OHOS::Sensors::SUCCESS;
 }
 
+int32_t SensorAgentProxy::SetCoalesceWindow(const SensorDescription &sensorDesc, const SensorUser *user,
+    int64_t windowNs)
+{
+    CHKPR(user, OHOS::Sensors::ERROR);
+    if (!SEN_CLIENT.IsValid(sensorDesc)) {
+        SEN_HILOGE("sensorDesc is invalid, deviceIndex:%{public}d, sensortypeId:%{public}d, sensorId:%{public}d",
+            sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId);
+        return PARAMETER_ERROR;
+    }
+    if (windowNs < 0) {
+        SEN_HILOGE("windowNs is invalid");
+        return OHOS::Sensors::ERROR;
+    }
+    {
+        std::lock_guard<std::recursive_mutex> subscribeLock(subscribeMutex_);
+        auto it = subscribeMap_.find(sensorDesc);
+        if ((it == subscribeMap_.end()) || (it->second.find(user) == it->second.end())) {
+            SEN_HILOGE("Subscribe user first");
+            return OHOS::Sensors::ERROR;
+        }
+    }
+    return SEN_CLIENT.SetCoalesceWindow(sensorDesc, windowNs);
+}
+
 int32_t SensorAgentProxy::SubscribeSensor(const SensorDescription &sensorDesc, const SensorUser *user)
 {
     SEN_HILOGI("In, deviceIndex:%{public}d, sensortypeId:%{public}d, sensorId:%{public}d",
@@ -658,6 +685,44 @@ int32_t SensorAgentProxy::ResumeSensors(int32_t pid)
     return ret;
 }
 
+int32_t SensorAgentProxy::SuspendSensorsBatch(const int32_t *pids, int32_t count)
+{
+    CALL_LOG_ENTER;
+    CHKPR(pids, OHOS::Sensors::ERROR);
+    if ((count <= 0) || std::any_of(pids, pids + count, [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid list is invalid, count:%{public}d", count);
+        return PARAMETER_ERROR;
+    }
+    int32_t ret = 0;
+    {
+        SensorXcollie SensorXcollie("SensorAgentProxy:SuspendSensorsBatch", XCOLLIE_TIMEOUT_5S);
+        ret = SEN_CLIENT.SuspendSensorsBatch(std::vector<int32_t>(pids, pids + count));
+    }
+    if (ret != ERR_OK) {
+        SEN_HILOGD("Suspend sensors batch failed, ret:%{public}d", ret);
+    }
+    return ret;
+}
+
+int32_t SensorAgentProxy::ResumeSensorsBatch(const int32_t *pids, int32_t count)
+{
+    CALL_LOG_ENTER;
+    CHKPR(pids, OHOS::Sensors::ERROR);
+    if ((count <= 0) || std::any_of(pids, pids + count, [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid list is invalid, count:%{public}d", count);
+        return PARAMETER_ERROR;
+    }
+    int32_t ret = 0;
+    {
+        SensorXcollie SensorXcollie("SensorAgentProxy:ResumeSensorsBatch", XCOLLIE_TIMEOUT_5S);
+        ret = SEN_CLIENT.ResumeSensorsBatch(std::vector<int32_t>(pids, pids + count));
+    }
+    if (ret != ERR_OK) {
+        SEN_HILOGD("Resume sensors batch failed, ret:%{public}d", ret);
+    }
+    return ret;
+}
+
 int32_t SensorAgentProxy::GetSensorActiveInfos(int32_t pid,
     SensorActiveInfo **sensorActiveInfos, int32_t *count) const
 {
@@ -880,5 +945,31 @@ bool SensorAgentProxy::HandlePlugSensorData(const SensorPlugData &info) __attrib
     }
     return true;
 }
+
+int32_t SensorAgentProxy::SetBusyPollWindow(int64_t windowUs)
+{
+    CALL_LOG_ENTER;
+    if ((windowUs < 0) || (windowUs > MAX_BUSY_POLL_WINDOW_US)) {
+        SEN_HILOGE("windowUs is invalid, windowUs:%{public}" PRId64, windowUs);
+        return PARAMETER_ERROR;
+    }
+    CHKPR(dataChannel_, INVALID_POINTER);
+    dataChannel_->SetBusyPollWindow(windowUs);
+    return ERR_OK;
+}
+
+int32_t SensorAgentProxy::GetBusyPollStats(BusyPollStats &stats)
+{
+    CHKPR(dataChannel_, INVALID_POINTER);
+    stats = dataChannel_->GetBusyPollStats();
+    return ERR_OK;
+}
+
+int32_t SensorAgentProxy::GetLostEventCount(uint64_t &count)
+{
+    CHKPR(dataChannel_, INVALID_POINTER);
+    count = dataChannel_->GetLostEventCount();
+    return ERR_OK;
+}
 } // namespace Sensors
 } // namespace OHOS
\ No newline at end of file
@@ -13,6 +13,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cerrno>
+#include <sys/socket.h>
+#include <time.h>
+
 #include "fd_listener.h"
 #include "sensor_errors.h"
 #include "sensor_file_descriptor_listener.h"
@@ -24,6 +29,22 @@ namespace Sensors {
 using namespace OHOS::HiviewDFX;
 using namespace OHOS::AppExecFwk;
 
+namespace {
+constexpr int64_t NS_PER_US = 1000;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr int64_t MIN_BUSY_POLL_WINDOW_NS = 20 * NS_PER_US;
+constexpr int64_t MAX_BUSY_POLL_SPIN_NS = 2 * MAX_BUSY_POLL_WINDOW_US * NS_PER_US;
+
+int64_t GetClockTimeNs(clockid_t clockId)
+{
+    struct timespec ts = { 0, 0 };
+    if (clock_gettime(clockId, &ts) != 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(ts.tv_sec) * NS_PER_SECOND + ts.tv_nsec;
+}
+} // namespace
+
 int32_t SensorDataChannel::CreateSensorDataChannel(DataChannelCB callBack, void *data)
 {
     SEN_HILOGI("In");
@@ -53,6 +74,9 @@ int32_t SensorDataChannel::InnerSensorDataChannel()
         SEN_HILOGE("Create basic channel failed, ret:%{public}d", ret);
         return ret;
     }
+    if (GrantCredit(INITIAL_CHANNEL_CREDIT) != ERR_OK) {
+        SEN_HILOGW("Grant initial credit failed, the service sends without flow control");
+    }
     auto listener = std::make_shared<SensorFileDescriptorListener>();
     listener->SetChannel(this);
     if (eventHandler_ == nullptr) {
@@ -140,5 +164,63 @@ DisconnectFun SensorDataChannel::GetDisconnectFun() const
 {
     return disconnect_;
 }
+
+void SensorDataChannel::SetBusyPollWindow(int64_t windowUs)
+{
+    std::lock_guard<std::mutex> busyPollLock(busyPollMutex_);
+    maxBusyPollWindowNs_.store(windowUs * NS_PER_US);
+    busyPollWindowNs_ = windowUs * NS_PER_US;
+    busyPollStats_ = {};
+    busyPollStats_.windowUs = windowUs;
+}
+
+BusyPollStats SensorDataChannel::GetBusyPollStats()
+{
+    std::lock_guard<std::mutex> busyPollLock(busyPollMutex_);
+    return busyPollStats_;
+}
+
+void SensorDataChannel::BusyPoll(const std::function<void()> &receive)
+{
+    int64_t maxWindowNs = maxBusyPollWindowNs_.load();
+    if (maxWindowNs <= 0) {
+        return;
+    }
+    int64_t windowNs = 0;
+    {
+        std::lock_guard<std::mutex> busyPollLock(busyPollMutex_);
+        windowNs = std::min(busyPollWindowNs_, maxWindowNs);
+    }
+    int32_t receiveFd = GetReceiveDataFd();
+    int64_t cpuStartNs = GetClockTimeNs(CLOCK_THREAD_CPUTIME_ID);
+    int64_t startNs = GetClockTimeNs(CLOCK_MONOTONIC);
+    int64_t deadlineNs = startNs + windowNs;
+    // A hit restarts the window, but one wake-up never holds the handler thread longer than MAX_BUSY_POLL_SPIN_NS
+    int64_t spinLimitNs = startNs + MAX_BUSY_POLL_SPIN_NS;
+    int64_t nowNs = startNs;
+    bool hit = false;
+    char probe = 0;
+    while ((receiveFd >= 0) && (nowNs < deadlineNs)) {
+        ssize_t length = recv(receiveFd, &probe, sizeof(probe), MSG_PEEK | MSG_DONTWAIT);
+        if (length > 0) {
+            receive();
+            hit = true;
+            deadlineNs = std::min(GetClockTimeNs(CLOCK_MONOTONIC) + windowNs, spinLimitNs);
+        } else if ((length == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))) {
+            break;
+        }
+        nowNs = GetClockTimeNs(CLOCK_MONOTONIC);
+    }
+    int64_t cpuTimeNs = GetClockTimeNs(CLOCK_THREAD_CPUTIME_ID) - cpuStartNs;
+    std::lock_guard<std::mutex> busyPollLock(busyPollMutex_);
+    // A window that found data is worth its cost, so grow it back; an idle one only burned CPU, so halve it.
+    busyPollWindowNs_ = hit ? std::min(windowNs * 2, maxWindowNs) :
+        std::max(windowNs / 2, std::min(MIN_BUSY_POLL_WINDOW_NS, maxWindowNs));
+    ++busyPollStats_.pollCount;
+    busyPollStats_.hitCount += hit ? 1 : 0;
+    busyPollStats_.spinTimeNs += nowNs - startNs;
+    busyPollStats_.cpuTimeNs += cpuTimeNs;
+    busyPollStats_.windowUs = busyPollWindowNs_ / NS_PER_US;
+}
 } // namespace Sensors
 } // namespace OHOS
@@ -14,6 +14,11 @@
  */
 
 #include "sensor_file_descriptor_listener.h"
+
+#include <cinttypes>
+
+#include "securec.h"
+
 #include "print_sensor_data.h"
 #include "sensor_errors.h"
 
@@ -55,36 +60,170 @@ void SensorFileDescriptorListener::OnReadable(int32_t fileDescriptor)
         SEN_HILOGE("Receive data buff_ is null");
         return;
     }
-    channel_->ReceiveData([this] (int32_t length) {
-            this->ExcuteCallback(length);
-        }, receiveDataBuff_, sizeof(SensorData) * RECEIVE_DATA_SIZE);
+    auto receive = [this] () {
+        channel_->ReceiveData([this] (int32_t length) {
+                this->ExcuteCallback(length);
+            }, receiveDataBuff_, sizeof(SensorData) * RECEIVE_DATA_SIZE);
+        ReturnCredit();
+    };
+    receive();
+    channel_->BusyPoll(receive);
 }
 
 void SensorFileDescriptorListener::ExcuteCallback(int32_t length)
 {
-    int32_t eventSize = static_cast<int32_t>(sizeof(SensorData));
-    int32_t num = length / eventSize;
-    if (num <= 0 || num > RECEIVE_DATA_SIZE) {
-        SEN_HILOGE("num:%{public}d is invalid", num);
+    if (length <= 0 || length > static_cast<int32_t>(sizeof(SensorData) * RECEIVE_DATA_SIZE)) {
+        SEN_HILOGE("length:%{public}d is invalid", length);
         return;
     }
-    for (int i = 0; i < num; i++) {
-        SensorEvent event = {
-            .sensorTypeId = receiveDataBuff_[i].sensorTypeId,
-            .version = receiveDataBuff_[i].version,
-            .timestamp = receiveDataBuff_[i].timestamp,
-            .option = receiveDataBuff_[i].option,
-            .mode = receiveDataBuff_[i].mode,
-            .data = receiveDataBuff_[i].data,
-            .dataLen = receiveDataBuff_[i].dataLen,
-            .deviceId = receiveDataBuff_[i].deviceId,
-            .sensorId = receiveDataBuff_[i].sensorId,
-            .location = receiveDataBuff_[i].location
-        };
-        if (receiveDataBuff_[i].sensorTypeId == SENSOR_TYPE_ID_HALL_EXT) {
-            PrintSensorData::GetInstance().PrintSensorDataLog("ExcuteCallback", receiveDataBuff_[i]);
+    auto buf = reinterpret_cast<char *>(receiveDataBuff_);
+    size_t size = static_cast<size_t>(length);
+    size_t offset = 0;
+    while (offset < size) {
+        bool ret = false;
+        switch (static_cast<uint8_t>(buf[offset])) {
+            case COMPACT_RECORD_SENSOR: {
+                ret = DecodeSensorRecord(buf, size, offset);
+                break;
+            }
+            case COMPACT_RECORD_EVENT: {
+                ret = DecodeEventRecord(buf, size, offset);
+                break;
+            }
+            case COMPACT_RECORD_GAP: {
+                ret = DecodeGapRecord(buf, size, offset);
+                break;
+            }
+            default: {
+                SEN_HILOGE("Invalid record type:%{public}u", static_cast<uint8_t>(buf[offset]));
+                break;
+            }
+        }
+        if (!ret) {
+            DropRemainingEvents(buf, size, offset);
+            return;
+        }
+    }
+}
+
+void SensorFileDescriptorListener::DropRemainingEvents(const char *buf, size_t size, size_t offset)
+{
+    // The sender charged credit for every event in the packet, so the undecoded ones are still handed back.
+    // Once the framing is lost the tail is counted as if it held only bare event records.
+    uint32_t dropCount = 0;
+    while (offset < size) {
+        size_t recordSize = 0;
+        uint8_t type = static_cast<uint8_t>(buf[offset]);
+        if ((type == COMPACT_RECORD_EVENT) && (size - offset >= sizeof(CompactEventRecord))) {
+            CompactEventRecord record;
+            if (memcpy_s(&record, sizeof(record), buf + offset, sizeof(record)) == EOK) {
+                recordSize = sizeof(record) + record.dataLen;
+                ++dropCount;
+            }
+        } else if ((type == COMPACT_RECORD_SENSOR) && (size - offset >= sizeof(CompactSensorRecord))) {
+            recordSize = sizeof(CompactSensorRecord);
+        } else if ((type == COMPACT_RECORD_GAP) && (size - offset >= sizeof(CompactGapRecord))) {
+            recordSize = sizeof(CompactGapRecord);
+        }
+        if (recordSize == 0) {
+            dropCount += static_cast<uint32_t>((size - offset + sizeof(CompactEventRecord) - 1) /
+                sizeof(CompactEventRecord));
+            break;
         }
-        channel_->dataCB_(&event, 1, channel_->privateData_);
+        offset += std::min(recordSize, size - offset);
+    }
+    if (dropCount == 0) {
+        return;
+    }
+    SEN_HILOGW("Drop undecodable events, count:%{public}u", dropCount);
+    consumedCount_ += dropCount;
+    channel_->AddLostEventCount(dropCount);
+}
+
+bool SensorFileDescriptorListener::DecodeSensorRecord(const char *buf, size_t size, size_t &offset)
+{
+    CompactSensorRecord record;
+    if ((size - offset < sizeof(record)) ||
+        (memcpy_s(&record, sizeof(record), buf + offset, sizeof(record)) != EOK)) {
+        SEN_HILOGE("Truncated sensor record, offset:%{public}zu, size:%{public}zu", offset, size);
+        return false;
+    }
+    sensorRecords_[record.handle] = record;
+    validHandles_.set(record.handle);
+    offset += sizeof(record);
+    return true;
+}
+
+bool SensorFileDescriptorListener::DecodeEventRecord(const char *buf, size_t size, size_t &offset)
+{
+    CompactEventRecord record;
+    if ((size - offset < sizeof(record)) ||
+        (memcpy_s(&record, sizeof(record), buf + offset, sizeof(record)) != EOK) ||
+        (size - offset - sizeof(record) < record.dataLen)) {
+        SEN_HILOGE("Truncated event record, offset:%{public}zu, size:%{public}zu", offset, size);
+        return false;
+    }
+    offset += sizeof(record);
+    const char *payload = buf + offset;
+    offset += record.dataLen;
+    ++consumedCount_;
+    if (!validHandles_.test(record.handle)) {
+        SEN_HILOGW("Unknown handle:%{public}u, drop event", record.handle);
+        return true;
+    }
+    CompactSensorRecord &sensor = sensorRecords_[record.handle];
+    sensor.timestamp += static_cast<int64_t>(record.timestampDelta);
+    // The payload follows a packed record and is not aligned for the float reads done by callbacks
+    if (memcpy_s(eventData_.data, sizeof(eventData_.data), payload, record.dataLen) != EOK) {
+        SEN_HILOGE("Event payload is too long, dataLen:%{public}u, drop event", record.dataLen);
+        return true;
+    }
+    SensorEvent event = {
+        .sensorTypeId = sensor.sensorTypeId,
+        .version = sensor.version,
+        .timestamp = sensor.timestamp,
+        .option = sensor.option,
+        .mode = sensor.mode,
+        .data = eventData_.data,
+        .dataLen = record.dataLen,
+        .deviceId = sensor.deviceId,
+        .sensorId = sensor.sensorId,
+        .location = sensor.location
+    };
+    if (sensor.sensorTypeId == SENSOR_TYPE_ID_HALL_EXT) {
+        eventData_.sensorTypeId = sensor.sensorTypeId;
+        eventData_.timestamp = sensor.timestamp;
+        eventData_.deviceId = sensor.deviceId;
+        eventData_.sensorId = sensor.sensorId;
+        eventData_.location = sensor.location;
+        PrintSensorData::GetInstance().PrintSensorDataLog("ExcuteCallback", eventData_);
+    }
+    channel_->dataCB_(&event, 1, channel_->privateData_);
+    return true;
+}
+
+bool SensorFileDescriptorListener::DecodeGapRecord(const char *buf, size_t size, size_t &offset)
+{
+    CompactGapRecord record;
+    if ((size - offset < sizeof(record)) ||
+        (memcpy_s(&record, sizeof(record), buf + offset, sizeof(record)) != EOK)) {
+        SEN_HILOGE("Truncated gap record, offset:%{public}zu, size:%{public}zu", offset, size);
+        return false;
+    }
+    offset += sizeof(record);
+    if (record.lostCount > lostCount_) {
+        SEN_HILOGW("Service dropped events, count:%{public}" PRIu64 ", total:%{public}" PRIu64,
+            record.lostCount - lostCount_, record.lostCount);
+        channel_->AddLostEventCount(record.lostCount - lostCount_);
+        lostCount_ = record.lostCount;
+    }
+    return true;
+}
+
+void SensorFileDescriptorListener::ReturnCredit()
+{
+    if ((consumedCount_ >= CREDIT_GRANT_BATCH) && (channel_->GrantCredit(consumedCount_) == ERR_OK)) {
+        consumedCount_ = 0;
     }
 }
 
@@ -15,6 +15,11 @@
 
 #include "sensor_service_client.h"
 
+#include <chrono>
+#include <cinttypes>
+#include <future>
+#include <unistd.h>
+
 #include "death_recipient_template.h"
 #ifdef HIVIEWDFX_HISYSEVENT_ENABLE
 #include "hisysevent.h"
@@ -22,6 +27,7 @@
 #ifdef HIVIEWDFX_HITRACE_ENABLE
 #include "hitrace_meter.h"
 #endif // HIVIEWDFX_HITRACE_ENABLE
+#include "message_schema.h"
 #include "sensor_agent_proxy.h"
 #include "system_ability_definition.h"
 
@@ -35,7 +41,7 @@ using namespace OHOS::HiviewDFX;
 namespace {
 #ifdef OHOS_BUILD_ENABLE_RUST
 extern "C" {
-    void ReadClientPackets(RustStreamBuffer *, OHOS::Sensors::SensorServiceClient *,
+    void ReadClientPackets(RustCircleStreamBuffer *, OHOS::Sensors::SensorServiceClient *,
         void(*)(OHOS::Sensors::SensorServiceClient *, RustNetPacket *));
     void OnPacket(SensorServiceClient *object, RustNetPacket *cPkt)
     {
@@ -69,9 +75,10 @@ int32_t SensorServiceClient::DealAfterServiceAlive()
     sptr<IRemoteObject> remoteObject = sensorServer_->AsObject();
     CHKPR(remoteObject, SENSOR_NATIVE_GET_SERVICE_ERR);
     remoteObject->AddDeathRecipient(serviceDeathObserver_);
+    // Catalog generations restart with the service, so the list of a previous instance is never reused
     sensorList_.clear();
-    int32_t ret = sensorServer_->GetSensorList(sensorList_);
-    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST, ret);
+    catalogView_.Unmap();
+    int32_t ret = LoadSensorList();
     if (sensorList_.empty()) {
         SEN_HILOGW("sensorList_ is empty when connecting to the service for the first time");
     }
@@ -89,8 +96,7 @@ int32_t SensorServiceClient::InitServiceClient()
     if (sensorServer_ != nullptr) {
         SEN_HILOGD("Already init");
         if (sensorList_.empty()) {
-            int32_t ret = sensorServer_->GetSensorList(sensorList_);
-            WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST, ret);
+            LoadSensorList();
             SEN_HILOGW("sensorList is %{public}s", sensorList_.empty() ? "empty" : "not empty");
         }
         return ERR_OK;
@@ -122,6 +128,40 @@ int32_t SensorServiceClient::InitServiceClient()
     return ret;
 }
 
+int32_t SensorServiceClient::LoadSensorList()
+{
+    CHKPR(sensorServer_, ERROR);
+    // The service flags the mapped snapshot once a newer generation exists, an unchanged list needs no IPC
+    if (!sensorList_.empty() && catalogView_.IsMapped() && !catalogView_.IsStale()) {
+        SEN_HILOGD("Sensor catalog unchanged, generation:%{public}" PRIu64, catalogGeneration_);
+        return ERR_OK;
+    }
+    int32_t catalogFd = -1;
+    int32_t ret = sensorServer_->GetSensorCatalog(catalogFd);
+    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_CATALOG, ret);
+    if (catalogFd >= 0) {
+        int32_t loadRet = (ret == ERR_OK) ? catalogView_.Map(catalogFd) : ret;
+        close(catalogFd);
+        std::vector<Sensor> sensors;
+        uint64_t generation = 0;
+        if (loadRet == ERR_OK) {
+            loadRet = catalogView_.Decode(sensors, generation);
+        }
+        if (loadRet == ERR_OK) {
+            sensorList_ = std::move(sensors);
+            catalogGeneration_ = generation;
+            SEN_HILOGD("Sensor catalog loaded, generation:%{public}" PRIu64, catalogGeneration_);
+            return ERR_OK;
+        }
+        catalogView_.Unmap();
+    }
+    SEN_HILOGW("Load sensor catalog failed, ret:%{public}d", ret);
+    sensorList_.clear();
+    ret = sensorServer_->GetSensorList(sensorList_);
+    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST, ret);
+    return ret;
+}
+
 bool SensorServiceClient::LoadSensorService()
 {
     SEN_HILOGI("LoadSensorService in");
@@ -195,6 +235,29 @@ int32_t SensorServiceClient::EnableSensor(const SensorDescription &sensorDesc, i
     return ret;
 }
 
+int32_t SensorServiceClient::SetCoalesceWindow(const SensorDescription &sensorDesc, int64_t windowNs)
+{
+    CALL_LOG_ENTER;
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    CHKPR(sensorServer_, ERROR);
+    ret = sensorServer_->SetCoalesceWindow({sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId,
+        sensorDesc.location}, windowNs);
+    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_SET_COALESCE_WINDOW, ret);
+    if (ret == ERR_OK) {
+        std::lock_guard<std::mutex> mapLock(mapMutex_);
+        auto it = sensorInfoMap_.find(sensorDesc);
+        if (it != sensorInfoMap_.end()) {
+            it->second.SetCoalesceWindowNs(windowNs);
+        }
+    }
+    return ret;
+}
+
 int32_t SensorServiceClient::DisableSensor(const SensorDescription &sensorDesc)
 {
     CALL_LOG_ENTER;
@@ -220,6 +283,74 @@ int32_t SensorServiceClient::DisableSensor(const SensorDescription &sensorDesc)
     return ret;
 }
 
+int32_t SensorServiceClient::EnableSensors(const std::vector<SensorEnableInfoIPC> &enableInfos,
+    std::vector<int32_t> &results)
+{
+    CALL_LOG_ENTER;
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    CHKPR(sensorServer_, ERROR);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    StartTrace(HITRACE_TAG_SENSORS, "EnableSensors");
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    ret = sensorServer_->EnableSensors(enableInfos, results);
+    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_ENABLE_SENSORS, ret);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    FinishTrace(HITRACE_TAG_SENSORS);
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    if (ret != ERR_OK || results.size() != enableInfos.size()) {
+        SEN_HILOGE("EnableSensors failed, ret:%{public}d", ret);
+        return (ret != ERR_OK) ? ret : ERROR;
+    }
+    for (size_t i = 0; i < enableInfos.size(); ++i) {
+        if (results[i] == ERR_OK) {
+            const SensorDescriptionIPC &desc = enableInfos[i].sensorDesc;
+            UpdateSensorInfoMap({desc.deviceId, desc.sensorType, desc.sensorId, desc.location},
+                enableInfos[i].samplingPeriodNs, enableInfos[i].maxReportDelayNs);
+        }
+    }
+    return ERR_OK;
+}
+
+int32_t SensorServiceClient::DisableSensors(const std::vector<SensorDescription> &sensorDescs,
+    std::vector<int32_t> &results)
+{
+    CALL_LOG_ENTER;
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    CHKPR(sensorServer_, ERROR);
+    std::vector<SensorDescriptionIPC> descs;
+    for (const auto &sensorDesc : sensorDescs) {
+        descs.emplace_back(sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId, sensorDesc.location);
+    }
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    StartTrace(HITRACE_TAG_SENSORS, "DisableSensors");
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    ret = sensorServer_->DisableSensors(descs, results);
+    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_DISABLE_SENSORS, ret);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    FinishTrace(HITRACE_TAG_SENSORS);
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    if (ret != ERR_OK || results.size() != sensorDescs.size()) {
+        SEN_HILOGE("DisableSensors failed, ret:%{public}d", ret);
+        return (ret != ERR_OK) ? ret : ERROR;
+    }
+    for (size_t i = 0; i < sensorDescs.size(); ++i) {
+        if (results[i] == ERR_OK) {
+            DeleteSensorInfoItem(sensorDescs[i]);
+        }
+    }
+    return ERR_OK;
+}
+
 std::vector<Sensor> SensorServiceClient::GetSensorList()
 {
     CALL_LOG_ENTER;
@@ -250,11 +381,21 @@ int32_t SensorServiceClient::GetSensorListByDevice(int32_t deviceId, std::vector
             singleDevSensors.push_back(sensor);
         }
     }
-    if (singleDevSensors.empty()) {
-        singleDevSensors = GetSensorListByDevice(deviceId);
-        if (singleDevSensors.empty()) {
-            SEN_HILOGW("singleDevSensors is empty");
+    if (!singleDevSensors.empty()) {
+        return ERR_OK;
+    }
+    // A plugged device shows up in the next catalog generation, the refreshed list is complete on its own
+    if (LoadSensorList() == ERR_OK) {
+        for (const auto& sensor : sensorList_) {
+            if (sensor.GetDeviceId() == deviceId) {
+                singleDevSensors.push_back(sensor);
+            }
         }
+    } else {
+        singleDevSensors = GetSensorListByDevice(deviceId);
+    }
+    if (singleDevSensors.empty()) {
+        SEN_HILOGW("singleDevSensors is empty");
     }
     return ERR_OK;
 }
@@ -372,23 +513,101 @@ int32_t SensorServiceClient::DestroyDataChannel()
 void SensorServiceClient::ReenableSensor()
 {
     CALL_LOG_ENTER;
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<SensorEnableInfoIPC> enableInfos;
+    std::map<SensorDescription, int64_t> coalesceWindows;
     {
-        std::lock_guard<std::mutex> clientLock(clientMutex_);
         std::lock_guard<std::mutex> mapLock(mapMutex_);
         for (const auto &it : sensorInfoMap_) {
-            if (sensorServer_ != nullptr) {
-                int32_t ret = sensorServer_->EnableSensor({it.first.deviceId, it.first.sensorType, it.first.sensorId,
-                    it.first.location}, it.second.GetSamplingPeriodNs(), it.second.GetMaxReportDelayNs());
-                WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_ENABLE_SENSOR, ret);
+            enableInfos.emplace_back(SensorDescriptionIPC(it.first.deviceId, it.first.sensorType, it.first.sensorId,
+                it.first.location), it.second.GetSamplingPeriodNs(), it.second.GetMaxReportDelayNs());
+            if (it.second.GetCoalesceWindowNs() > 0) {
+                coalesceWindows[it.first] = it.second.GetCoalesceWindowNs();
             }
         }
     }
-    if (!isConnected_) {
+    sptr<ISensorService> sensorServer = nullptr;
+    {
+        std::lock_guard<std::mutex> clientLock(clientMutex_);
+        sensorServer = sensorServer_;
+    }
+    std::future<int32_t> channelTask;
+    if (isConnected_) {
+        channelTask = std::async(std::launch::async, [this] {
+            Disconnect();
+            return CreateSocketChannel();
+        });
+    } else {
         SEN_HILOGD("Previous socket channel status is false, not need retry creat socket channel");
+    }
+    int32_t failCount = RestoreSensors(sensorServer, enableInfos);
+    RestoreCoalesceWindows(sensorServer, coalesceWindows);
+    if (channelTask.valid()) {
+        int32_t ret = channelTask.get();
+        if (ret != ERR_OK) {
+            SEN_HILOGE("Recreate socket channel failed, ret:%{public}d", ret);
+        }
+    }
+    int64_t restoreTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    SEN_HILOGI("Restore done, sensorCount:%{public}zu, failCount:%{public}d, restoreTime:%{public}" PRId64 "ms",
+        enableInfos.size(), failCount, restoreTimeMs);
+#ifdef HIVIEWDFX_HISYSEVENT_ENABLE
+    HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SENSOR_RESTORE", HiSysEvent::EventType::STATISTIC,
+        "SENSOR_COUNT", static_cast<int32_t>(enableInfos.size()), "FAIL_COUNT", failCount,
+        "RESTORE_TIME", restoreTimeMs);
+#endif // HIVIEWDFX_HISYSEVENT_ENABLE
+}
+
+int32_t SensorServiceClient::RestoreSensors(sptr<ISensorService> sensorServer,
+    const std::vector<SensorEnableInfoIPC> &enableInfos)
+{
+    if (enableInfos.empty()) {
+        return 0;
+    }
+    CHKPR(sensorServer, static_cast<int32_t>(enableInfos.size()));
+    int32_t failCount = 0;
+    std::vector<int32_t> results;
+    int32_t ret = sensorServer->EnableSensors(enableInfos, results);
+    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_ENABLE_SENSORS, ret);
+    if ((ret == ERR_OK) && (results.size() == enableInfos.size())) {
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (results[i] != ERR_OK) {
+                SEN_HILOGE("Restore sensor failed, sensorType:%{public}d, ret:%{public}d",
+                    enableInfos[i].sensorDesc.sensorType, results[i]);
+                ++failCount;
+            }
+        }
+        return failCount;
+    }
+    SEN_HILOGW("Batched restore failed, ret:%{public}d, fall back to single enable", ret);
+    for (const auto &enableInfo : enableInfos) {
+        ret = sensorServer->EnableSensor(enableInfo.sensorDesc, enableInfo.samplingPeriodNs,
+            enableInfo.maxReportDelayNs);
+        WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_ENABLE_SENSOR, ret);
+        if (ret != ERR_OK) {
+            ++failCount;
+        }
+    }
+    return failCount;
+}
+
+void SensorServiceClient::RestoreCoalesceWindows(sptr<ISensorService> sensorServer,
+    const std::map<SensorDescription, int64_t> &coalesceWindows)
+{
+    if (coalesceWindows.empty()) {
         return;
     }
-    Disconnect();
-    CreateSocketChannel();
+    CHKPV(sensorServer);
+    for (const auto &it : coalesceWindows) {
+        int32_t ret = sensorServer->SetCoalesceWindow({it.first.deviceId, it.first.sensorType, it.first.sensorId,
+            it.first.location}, it.second);
+        WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_SET_COALESCE_WINDOW, ret);
+        if (ret != ERR_OK) {
+            SEN_HILOGW("Restore coalesce window failed, sensorType:%{public}d, ret:%{public}d",
+                it.first.sensorType, ret);
+        }
+    }
 }
 
 int32_t SensorServiceClient::CreateClientRemoteObject()
@@ -511,6 +730,22 @@ void SensorServiceClient::WriteHiSysIPCEventSplit(ISensorServiceIpcCode code, in
                 HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SERVICE_IPC_EXCEPTION", HiSysEvent::EventType::FAULT,
                     "PKG_NAME", "DestroyClientRemoteObject", "ERROR_CODE", ret);
                 break;
+            case ISensorServiceIpcCode::COMMAND_ENABLE_SENSORS:
+                HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SERVICE_IPC_EXCEPTION", HiSysEvent::EventType::FAULT,
+                    "PKG_NAME", "EnableSensors", "ERROR_CODE", ret);
+                break;
+            case ISensorServiceIpcCode::COMMAND_DISABLE_SENSORS:
+                HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SERVICE_IPC_EXCEPTION", HiSysEvent::EventType::FAULT,
+                    "PKG_NAME", "DisableSensors", "ERROR_CODE", ret);
+                break;
+            case ISensorServiceIpcCode::COMMAND_GET_SENSOR_CATALOG:
+                HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SERVICE_IPC_EXCEPTION", HiSysEvent::EventType::FAULT,
+                    "PKG_NAME", "GetSensorCatalog", "ERROR_CODE", ret);
+                break;
+            case ISensorServiceIpcCode::COMMAND_SET_COALESCE_WINDOW:
+                HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SERVICE_IPC_EXCEPTION", HiSysEvent::EventType::FAULT,
+                    "PKG_NAME", "SetCoalesceWindow", "ERROR_CODE", ret);
+                break;
             default:
                 SEN_HILOGW("Code does not exist, code:%{public}d", static_cast<int32_t>(code));
                 break;
@@ -573,6 +808,10 @@ void SensorServiceClient::UpdateSensorInfoMap(const SensorDescription &sensorDes
     sensorInfo.SetMaxReportDelayNs(maxReportDelay);
     sensorInfo.SetSensorState(true);
     std::lock_guard<std::mutex> mapLock(mapMutex_);
+    auto it = sensorInfoMap_.find(sensorDesc);
+    if (it != sensorInfoMap_.end()) {
+        sensorInfo.SetCoalesceWindowNs(it->second.GetCoalesceWindowNs());
+    }
     sensorInfoMap_[sensorDesc] = sensorInfo;
     SEN_HILOGI("Done");
     return;
@@ -630,6 +869,46 @@ int32_t SensorServiceClient::ResumeSensors(int32_t pid)
     return ret;
 }
 
+int32_t SensorServiceClient::SuspendSensorsBatch(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    CHKPR(sensorServer_, ERROR);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    StartTrace(HITRACE_TAG_SENSORS, "SuspendSensorsBatch");
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    ret = sensorServer_->SuspendSensorsBatch(pids);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    FinishTrace(HITRACE_TAG_SENSORS);
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    return ret;
+}
+
+int32_t SensorServiceClient::ResumeSensorsBatch(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    CHKPR(sensorServer_, ERROR);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    StartTrace(HITRACE_TAG_SENSORS, "ResumeSensorsBatch");
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    ret = sensorServer_->ResumeSensorsBatch(pids);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    FinishTrace(HITRACE_TAG_SENSORS);
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    return ret;
+}
+
 int32_t SensorServiceClient::GetActiveInfoList(int32_t pid, std::vector<ActiveInfo> &activeInfoList)
 {
     CALL_LOG_ENTER;
@@ -751,7 +1030,7 @@ void SensorServiceClient::ReceiveMessage(const char *buf, size_t size)
         SEN_HILOGE("Write data failed. size:%{public}zu", size);
     }
 #ifdef OHOS_BUILD_ENABLE_RUST
-    ReadClientPackets(circBuf_.streamBufferPtr_.get(), this, OnPacket);
+    ReadClientPackets(circBuf_.circleBufferPtr_.get(), this, OnPacket);
 #else
     OnReadPackets(circBuf_, [this] (NetPacket &pkt) { this->HandleNetPacke(pkt); });
 #endif // OHOS_BUILD_ENABLE_RUST
@@ -764,21 +1043,20 @@ void SensorServiceClient::HandleNetPacke(NetPacket &pkt)
         SEN_HILOGE("NetPacke message id is not ACTIVE_INFO");
         return;
     }
-    SensorActiveInfo sensorActiveInfo;
-    pkt >> sensorActiveInfo.pid >> sensorActiveInfo.sensorId >> sensorActiveInfo.samplingPeriodNs >>
-        sensorActiveInfo.maxReportDelayNs;
-#ifdef OHOS_BUILD_ENABLE_RUST
-    if (StreamBufferChkRWError(pkt.streamBufferPtr_.get())) {
-#else
-    if (pkt.ChkRWError()) {
-#endif // OHOS_BUILD_ENABLE_RUST
+    ActiveInfoRecord records[MAX_ACTIVE_INFO_BATCH];
+    size_t count = 0;
+    if (!DecodeMessage(pkt, records, MAX_ACTIVE_INFO_BATCH, count)) {
         SEN_HILOGE("Packet read type failed");
         return;
     }
     std::lock_guard<std::mutex> activeInfoCBLock(activeInfoCBMutex_);
-    for (auto callback : activeInfoCBSet_) {
-        if (callback != nullptr) {
-            callback(sensorActiveInfo);
+    for (size_t i = 0; i < count; ++i) {
+        SensorActiveInfo sensorActiveInfo = { records[i].pid, records[i].sensorId, records[i].samplingPeriodNs,
+            records[i].maxReportDelayNs };
+        for (auto callback : activeInfoCBSet_) {
+            if (callback != nullptr) {
+                callback(sensorActiveInfo);
+            }
         }
     }
 }
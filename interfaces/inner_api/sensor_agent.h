@@ -148,6 +148,29 @@ int32_t SuspendSensors(int32_t pid);
  */
 int32_t ResumeSensors(int32_t pid);
 
+/**
+ * @brief Suspends all sensors subscribed by a group of processes in a single request. Sensors shared by
+ * several of the processes are disabled or reconfigured once for the whole group.
+ *
+ * @param pids Indicates the pointer to the process IDs.
+ * @param count Indicates the number of process IDs.
+ * @return Returns <b>0</b> if all the sensors are suspended; returns a non-zero value otherwise.
+ *
+ * @since 20
+ */
+int32_t SuspendSensorsBatch(const int32_t *pids, int32_t count);
+
+/**
+ * @brief Resumes all sensors subscribed by a group of processes in a single request.
+ *
+ * @param pids Indicates the pointer to the process IDs.
+ * @param count Indicates the number of process IDs.
+ * @return Returns <b>0</b> if all the sensors are resumed; returns a non-zero value otherwise.
+ *
+ * @since 20
+ */
+int32_t ResumeSensorsBatch(const int32_t *pids, int32_t count);
+
 /**
  * @brief Obtains information about all sensors enabled by a process.
  *
@@ -309,6 +332,55 @@ int32_t SubscribeSensorPlug(const SensorUser *user);
  */
 int32_t UnsubscribeSensorPlug(const SensorUser *user);
 
+/**
+ * @brief Sets the busy-poll window of the sensor data channel of the calling process. After each delivery the
+ * reader keeps polling the channel for up to this window before it goes back to sleep, which trades CPU time for
+ * lower delivery latency. The window adapts to the traffic within this upper bound.
+ *
+ * @param windowUs Indicates the maximum busy-poll window, in us. The value ranges from <b>0</b> to <b>1000</b>.
+ * Busy polling is off by default, and the value <b>0</b> turns it off again.
+ * @return Returns <b>0</b> if the window is set; returns a non-zero value otherwise.
+ *
+ * @since 20
+ */
+int32_t SetBusyPollWindow(int64_t windowUs);
+
+/**
+ * @brief Obtains the busy-poll statistics of the sensor data channel of the calling process.
+ *
+ * @param stats Indicates the pointer to the statistics obtained. For details, see {@link BusyPollStats}.
+ * @return Returns <b>0</b> if the statistics are obtained; returns a non-zero value otherwise.
+ *
+ * @since 20
+ */
+int32_t GetBusyPollStats(BusyPollStats *stats);
+
+/**
+ * @brief Obtains the number of sensor events the service dropped for the calling process because the process
+ * did not keep up with the data rate.
+ *
+ * @param count Indicates the pointer to the number of events lost so far.
+ * @return Returns <b>0</b> if the number is obtained; returns a non-zero value otherwise.
+ *
+ * @since 20
+ */
+int32_t GetLostEventCount(uint64_t *count);
+
+/**
+ * @brief Sets the coalescing window of an on-change sensor for the calling process. Within the window only the
+ * latest value is delivered. Call it after {@link ActivateSensor}; the window is cleared when the sensor is
+ * deactivated.
+ *
+ * @param sensorTypeId Indicates the ID of a sensor type. For details, see {@link SensorTypeId}.
+ * @param user Indicates the pointer to the sensor subscriber that requests sensor data.
+ * For details, see {@link SensorUser}. A subscriber can obtain data from only one sensor.
+ * @param windowNs Indicates the coalescing window, in nanoseconds. The value <b>0</b> disables coalescing.
+ * @return Returns <b>0</b> if the setting is successful; returns a non-zero value otherwise.
+ *
+ * @since 20
+ */
+int32_t SetCoalesceWindow(int32_t sensorTypeId, const SensorUser *user, int64_t windowNs);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
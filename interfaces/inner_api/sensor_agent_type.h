@@ -558,6 +558,17 @@ typedef struct SensorIdentifier {
 
 typedef void (*SensorActiveInfoCB)(SensorActiveInfo &sensorActiveInfo);
 
+/**
+ * @brief Defines the CPU cost and effect of busy polling the sensor data channel of the process.
+ */
+typedef struct BusyPollStats {
+    int64_t windowUs = 0;   /**< Busy-poll window in use, in us. It shrinks while polls find no data */
+    uint64_t pollCount = 0; /**< Number of busy-poll windows entered after a delivery */
+    uint64_t hitCount = 0;  /**< Number of windows in which new data arrived before the window ended */
+    int64_t spinTimeNs = 0; /**< Wall time spent busy polling, in ns */
+    int64_t cpuTimeNs = 0;  /**< CPU time consumed by the reader thread while busy polling, in ns */
+} BusyPollStats;
+
 #ifdef __cplusplus
 #if __cplusplus
 }
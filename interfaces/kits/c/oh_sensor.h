@@ -101,6 +101,72 @@ Sensor_Result OH_Sensor_Subscribe(const Sensor_SubscriptionId *id,
  * @since 11
  */
 Sensor_Result OH_Sensor_Unsubscribe(const Sensor_SubscriptionId *id, const Sensor_Subscriber *subscriber);
+
+/**
+ * @brief Creates a pull-mode subscription to sensor data. Sensor data is written into a fixed-size ring owned by
+ * the subscription and is read with {@link OH_Sensor_Poll} from any single thread, without callbacks or locks.
+ * If the ring is full, new data is discarded until the caller polls again.
+ * The permissions required are the same as those of {@link OH_Sensor_Subscribe}.
+ *
+ * @param id - Pointer to the sensor subscription ID. For details, see {@link Sensor_SubscriptionId}.
+ * @param attribute - Pointer to the subscription attribute, which is used to specify the data reporting frequency.
+ * For details, see {@link Sensor_SubscriptionAttribute}.
+ * @param capacity - Number of events the ring can hold. The value is rounded up to a power of two and clamped to
+ * the range [16, 4096]: a smaller value gets a ring of 16 events and a larger value a ring of 4096 events. The call
+ * does not fail because of the clamping, so size the poll interval for at most 4096 buffered events.
+ * @param subscription - Double pointer to the created pull-mode subscription.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful; returns the following error code otherwise.
+ * {@link SENSOR_PERMISSION_DENIED} Permission verification failed.\n
+ * {@link SENSOR_PARAMETER_ERROR} Parameter check failed. For example, the parameter is invalid,
+ * or the parameter type passed in is incorrect.\n
+ * {@link SENSOR_SERVICE_EXCEPTION} The sensor service is abnormal.\n
+ * @permission ohos.permission.ACCELEROMETER or ohos.permission.GYROSCOPE or
+ *             ohos.permission.ACTIVITY_MOTION or ohos.permission.READ_HEALTH_DATA
+ * @since 20
+ */
+Sensor_Result OH_Sensor_CreatePollSubscription(const Sensor_SubscriptionId *id,
+    const Sensor_SubscriptionAttribute *attribute, uint32_t capacity, Sensor_PollSubscription **subscription);
+
+/**
+ * @brief Obtains all sensor data received since the previous poll. The events returned by the previous call are
+ * released back to the ring, and pointers to the new events are written to <b>events</b> in arrival order.
+ * The returned events remain valid until the next call to this function or until the subscription is destroyed.
+ *
+ * @param subscription - Pointer to the pull-mode subscription.
+ * @param events - Array receiving pointers to the new sensor data.
+ * @param maxCount - Number of elements in <b>events</b>.
+ * @param count - Pointer to the number of events written to <b>events</b>.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful; returns the following error code otherwise.
+ * {@link SENSOR_PARAMETER_ERROR} Parameter check failed. For example, the parameter is invalid,
+ * or the parameter type passed in is incorrect.\n
+ * @since 20
+ */
+Sensor_Result OH_Sensor_Poll(Sensor_PollSubscription *subscription, Sensor_Event **events, uint32_t maxCount,
+    uint32_t *count);
+
+/**
+ * @brief Obtains the number of sensor data discarded because the ring of a pull-mode subscription was full.
+ *
+ * @param subscription - Pointer to the pull-mode subscription.
+ * @param droppedCount - Pointer to the number of discarded sensor data.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful; returns the following error code otherwise.
+ * {@link SENSOR_PARAMETER_ERROR} Parameter check failed. For example, the parameter is invalid,
+ * or the parameter type passed in is incorrect.\n
+ * @since 20
+ */
+Sensor_Result OH_Sensor_GetPollDroppedCount(Sensor_PollSubscription *subscription, uint64_t *droppedCount);
+
+/**
+ * @brief Destroys a pull-mode subscription, unsubscribes from sensor data and reclaims the ring memory.
+ *
+ * @param subscription - Pointer to the pull-mode subscription.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful; returns the following error code otherwise.
+ * {@link SENSOR_PARAMETER_ERROR} Parameter check failed. For example, the parameter is invalid,
+ * or the parameter type passed in is incorrect.\n
+ * {@link SENSOR_SERVICE_EXCEPTION} The sensor service is abnormal.\n
+ * @since 20
+ */
+Sensor_Result OH_Sensor_DestroyPollSubscription(Sensor_PollSubscription *subscription);
 #ifdef __cplusplus
 }
 #endif
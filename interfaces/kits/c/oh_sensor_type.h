@@ -511,6 +511,13 @@ int32_t OH_SensorSubscriber_SetCallback(Sensor_Subscriber* subscriber, const Sen
  * @since 11
  */
 int32_t OH_SensorSubscriber_GetCallback(Sensor_Subscriber* subscriber, Sensor_EventCallback *callback);
+
+/**
+ * @brief Defines a pull-mode sensor subscription. Sensor data is stored in a fixed-size client ring
+ * and read by the caller with {@link OH_Sensor_Poll} instead of being reported through a callback.
+ * @since 20
+ */
+typedef struct Sensor_PollSubscription Sensor_PollSubscription;
 #ifdef __cplusplus
 }
 #endif
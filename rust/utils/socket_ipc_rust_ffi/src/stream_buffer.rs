@@ -17,9 +17,10 @@
 pub mod ffi;
 pub(super) mod net_packet;
 mod binding;
-use hilog_rust::{error, hilog, debug, HiLogLabel, LogType};
+use hilog_rust::{error, hilog, HiLogLabel, LogType};
 use std::ffi::{CString, c_char};
 use std::mem::size_of;
+use std::ptr;
 use binding::CSensorServiceClient;
 use net_packet::{NetPacket, CNetPacket, PackHead};
 type ErrorStatus = crate::stream_buffer::ErrStatus;
@@ -31,6 +32,8 @@ pub type ClientPacketCallBackFun = unsafe extern "C" fn (
 
 const ONCE_PROCESS_NETPACKET_LIMIT: i32 = 100;
 const MAX_STREAM_BUF_SIZE: usize = 256;
+/// default capacity of the client receive ring
+pub const DEFAULT_CIRCLE_BUF_SIZE: usize = 4096;
 /// max buffer size of packet
 pub const MAX_PACKET_BUF_SIZE: usize = 256;
 const PARAM_INPUT_INVALID: i32 = 5;
@@ -210,26 +213,6 @@ impl StreamBuffer {
         self.w_count += 1;
         true
     }
-    fn check_write(&mut self, size: usize) -> bool {
-        let buffer_size = size;
-        let mut avail_size = self.get_available_buf_size();
-        if buffer_size > avail_size && self.r_pos > 0 {
-            self.copy_data_to_begin();
-            avail_size = self.get_available_buf_size();
-        }
-        avail_size >= buffer_size
-    }
-    fn copy_data_to_begin(&mut self) {
-        let unread_size = self.unread_size();
-        if unread_size > 0 && self.r_pos > 0 {
-            for (index, value) in (self.r_pos..=self.w_pos).enumerate() {
-                self.sz_buff[index] = self.sz_buff[value];
-            }
-        }
-        debug!(LOG_LABEL, "unread_size:{} rPos:{} wPos:{}", unread_size, self.r_pos, self.w_pos);
-        self.r_pos = 0;
-        self.w_pos = unread_size;
-    }
     fn read_char_usize(&mut self, buf: *const c_char, size: usize) -> bool {
         if self.chk_rwerror() {
             return false;
@@ -262,59 +245,173 @@ impl StreamBuffer {
         self.r_count += 1;
         true
     }
-    fn circle_write(&mut self, buf: *const c_char, size: usize) -> bool {
+    fn r_count(&self) -> usize {
+        self.r_count
+    }
+    fn w_count(&self) -> usize {
+        self.w_count
+    }
+    fn w_pos(&self) -> usize {
+        self.w_pos
+    }
+    fn r_pos(&self) -> usize {
+        self.r_pos
+    }
+    fn sz_buff(&self) -> *const c_char {
+        &self.sz_buff[0] as *const c_char
+    }
+    fn set_rw_error_status(&mut self, rw_error_status: ErrorStatus) {
+        self.rw_error_status = rw_error_status
+    }
+    fn set_r_pos(&mut self, r_pos: usize) {
+        self.r_pos = r_pos
+    }
+}
+
+/// Byte ring used to reassemble packets received on the client socket. The capacity is a power of two,
+/// positions grow monotonically and are masked on access, so unread bytes are never moved.
+pub struct CircleStreamBuffer {
+    ring: Vec<c_char>,
+    mask: usize,
+    r_pos: usize,
+    w_pos: usize,
+}
+
+impl CircleStreamBuffer {
+    pub(crate) fn new(capacity: usize) -> Self {
+        let size = capacity.max(MAX_STREAM_BUF_SIZE).checked_next_power_of_two().unwrap_or(DEFAULT_CIRCLE_BUF_SIZE);
+        Self {
+            ring: vec![0; size],
+            mask: size - 1,
+            r_pos: 0,
+            w_pos: 0,
+        }
+    }
+    fn as_ref<'a>(object: *const Self) -> Option<&'a Self> {
+        // SAFETY: as_ref has already done no-null verification inside
+        unsafe {
+            object.as_ref()
+        }
+    }
+    fn as_mut<'a>(object: *mut Self) -> Option<&'a mut Self> {
+        // SAFETY: as_mut has already done no-null verification inside
+        unsafe {
+            object.as_mut()
+        }
+    }
+    fn capacity(&self) -> usize {
+        self.ring.len()
+    }
+    fn unread_size(&self) -> usize {
+        self.w_pos.wrapping_sub(self.r_pos)
+    }
+    fn is_empty(&self) -> bool {
+        self.unread_size() == 0
+    }
+    fn reset(&mut self) {
+        self.r_pos = 0;
+        self.w_pos = 0;
+    }
+    fn check_write(&self, size: usize) -> bool {
+        size <= self.capacity() - self.unread_size()
+    }
+    fn contiguous_read_size(&self) -> usize {
+        self.unread_size().min(self.capacity() - (self.r_pos & self.mask))
+    }
+    fn read_buf(&self) -> *const c_char {
+        &(self.ring[self.r_pos & self.mask]) as *const c_char
+    }
+    fn write(&mut self, buf: *const c_char, size: usize) -> bool {
+        if buf.is_null() {
+            error!(LOG_LABEL, "Invalid input parameter buf=nullptr errCode:{}", PARAM_INPUT_INVALID);
+            return false;
+        }
         if !self.check_write(size) {
-            error!(LOG_LABEL, "Out of buffer memory, availableSize:{}, size:{}, unreadSize:{}, rPos:{}, wPos:{}",
-                self.get_available_buf_size(), size, self.unread_size(),
-                self.r_pos, self.w_pos);
+            error!(LOG_LABEL, "Out of buffer memory, capacity:{}, size:{}, unreadSize:{}",
+                self.capacity(), size, self.unread_size());
+            return false;
+        }
+        let pos = self.w_pos & self.mask;
+        let first = size.min(self.capacity() - pos);
+        // SAFETY: buf holds size bytes, both ranges were bounded against the ring above
+        unsafe {
+            ptr::copy_nonoverlapping(buf, self.ring.as_mut_ptr().add(pos), first);
+            ptr::copy_nonoverlapping(buf.add(first), self.ring.as_mut_ptr(), size - first);
+        }
+        self.w_pos = self.w_pos.wrapping_add(size);
+        true
+    }
+    fn peek(&self, offset: usize, buf: *mut c_char, size: usize) -> bool {
+        if buf.is_null() {
+            error!(LOG_LABEL, "Invalid input parameter buf=nullptr errCode:{}", PARAM_INPUT_INVALID);
+            return false;
+        }
+        if offset > self.unread_size() || size > self.unread_size() - offset {
+            error!(LOG_LABEL, "Memory out of bounds on peek, offset:{} size:{} errCode:{}",
+                offset, size, MEM_OUT_OF_BOUNDS);
+            return false;
+        }
+        let pos = self.r_pos.wrapping_add(offset) & self.mask;
+        let first = size.min(self.capacity() - pos);
+        // SAFETY: buf holds size bytes, both ranges were bounded against the ring above
+        unsafe {
+            ptr::copy_nonoverlapping(self.ring.as_ptr().add(pos), buf, first);
+            ptr::copy_nonoverlapping(self.ring.as_ptr(), buf.add(first), size - first);
+        }
+        true
+    }
+    fn seek_read_pos(&mut self, n: usize) -> bool {
+        if n > self.unread_size() {
+            error!(LOG_LABEL, "The position in the calculation is not as expected. n:{} unreadSize:{}",
+                n, self.unread_size());
             return false;
         }
-        self.write_char_usize(buf, size)
+        self.r_pos = self.r_pos.wrapping_add(n);
+        true
     }
 
-    pub unsafe fn read_client_packets(&mut self, client: *const CSensorServiceClient, callback_fun: 
+    pub unsafe fn read_client_packets(&mut self, client: *const CSensorServiceClient, callback_fun:
         ClientPacketCallBackFun) {
         const HEAD_SIZE: usize = size_of::<PackHead>();
+        let mut data: [c_char; MAX_PACKET_BUF_SIZE] = [0; MAX_PACKET_BUF_SIZE];
         for _i in 0..ONCE_PROCESS_NETPACKET_LIMIT {
             let unread_size = self.unread_size();
             if unread_size < HEAD_SIZE {
                 break;
             }
-            let data_size = unread_size - HEAD_SIZE;
-            let buf: *const c_char = self.read_buf();
-            if buf.is_null() {
-                error!(LOG_LABEL, "buf is null, skip then break");
-                break;
-            }
-            let head: *const PackHead = buf as *const PackHead;
-            if head.is_null() {
-                error!(LOG_LABEL, "head is null, skip then break");
+            let mut head_buf: [c_char; HEAD_SIZE] = [0; HEAD_SIZE];
+            if !self.peek(0, head_buf.as_mut_ptr(), HEAD_SIZE) {
                 break;
             }
-            // SAFETY: head pointer should be not null certainly
-            let size = unsafe {
-                (*head).size
-            };
-            // SAFETY: head pointer should be not null certainly
-            let id_msg = unsafe {
-                (*head).id_msg
+            // SAFETY: head_buf holds HEAD_SIZE bytes copied from the ring
+            let head: PackHead = unsafe {
+                ptr::read_unaligned(head_buf.as_ptr() as *const PackHead)
             };
-            if !(0..=MAX_PACKET_BUF_SIZE).contains(&size) {
+            let size = head.size;
+            let id_msg = head.id_msg;
+            if size > MAX_PACKET_BUF_SIZE {
                 error!(LOG_LABEL, "Packet header parsing error, and this error cannot be recovered. \
                     The buffer will be reset. size:{}, unreadSize:{}", size, unread_size);
                 self.reset();
                 break;
             }
-            if size > data_size {
+            if size > unread_size - HEAD_SIZE {
                 break;
             }
             let mut pkt: NetPacket = NetPacket {
                 msg_id: id_msg,
                 ..Default::default()
             };
-            unsafe {
-                if size > 0 &&
-                    !pkt.stream_buffer.write_char_usize(buf.add(HEAD_SIZE) as *const c_char, size) {
+            if size > 0 {
+                // SAFETY: the payload was bounded against unread_size above
+                let mut payload: *const c_char = unsafe { self.read_buf().add(HEAD_SIZE) };
+                if self.contiguous_read_size() < HEAD_SIZE + size {
+                    if !self.peek(HEAD_SIZE, data.as_mut_ptr(), size) {
+                        break;
+                    }
+                    payload = data.as_ptr();
+                }
+                if !pkt.stream_buffer.write_char_usize(payload, size) {
                     error!(LOG_LABEL, "Error writing data in the NetPacket. It will be retried next time. \
                         messageid:{}, size:{}", id_msg as i32, size);
                     break;
@@ -339,26 +436,4 @@ impl StreamBuffer {
             }
         }
     }
-    fn r_count(&self) -> usize {
-        self.r_count
-    }
-    fn w_count(&self) -> usize {
-        self.w_count
-    }
-    fn w_pos(&self) -> usize {
-        self.w_pos
-    }
-    fn r_pos(&self) -> usize {
-        self.r_pos
-    }
-    fn sz_buff(&self) -> *const c_char {
-        &self.sz_buff[0] as *const c_char
-    }
-    fn set_rw_error_status(&mut self, rw_error_status: ErrorStatus) {
-        self.rw_error_status = rw_error_status
-    }
-    fn set_r_pos(&mut self, r_pos: usize) {
-        self.r_pos = r_pos
-    }
 }
-
@@ -197,67 +197,174 @@ pub unsafe extern "C" fn StreamBufferWriteChar(object: *mut StreamBuffer, buf: *
         false
     }
 }
-/// Check whether the condition of writing could be satisfied or not.
+/// Read sz_buf to buf.
 ///
 /// # Safety
 ///
 /// The pointer which pointed the memory already initialized must be valid.
 /// Makesure the memory shouldn't be dropped while whose pointer is being used.
 #[no_mangle]
-pub unsafe extern "C" fn StreamBufferCheckWrite(object: *mut StreamBuffer, size: usize) -> bool {
-    info!(LOG_LABEL, "enter StreamBufferCheckWrite");
+pub unsafe extern "C" fn StreamBufferReadChar(object: *mut StreamBuffer, buf: *const c_char, size: usize) -> bool {
+    info!(LOG_LABEL, "enter StreamBufferReadChar");
     if let Some(obj) = StreamBuffer::as_mut(object) {
+        obj.read_char_usize(buf, size)
+    } else {
+        false
+    }
+}
+/// Create unique_ptr of circle_stream_buffer for C++ code
+///
+/// # Safety
+///
+/// The returned pointer must be released with CircleStreamBufferDelete.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferCreate(capacity: usize) -> *mut CircleStreamBuffer {
+    info!(LOG_LABEL, "enter CircleStreamBufferCreate");
+    Box::into_raw(Box::new(CircleStreamBuffer::new(capacity)))
+}
+/// Drop unique_ptr of circle_stream_buffer for C++ code
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferDelete(raw: *mut CircleStreamBuffer) {
+    info!(LOG_LABEL, "enter CircleStreamBufferDelete");
+    if !raw.is_null() {
+        drop(Box::from_raw(raw));
+    }
+}
+/// Check whether size bytes fit into the free part of the ring.
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferCheckWrite(object: *const CircleStreamBuffer, size: usize) -> bool {
+    if let Some(obj) = CircleStreamBuffer::as_ref(object) {
         obj.check_write(size)
     } else {
         false
     }
 }
-/// CircleStreamBuffer will copy data to beginning.
+/// Append buf to the ring, wrapping at the end.
 ///
 /// # Safety
 ///
 /// The pointer which pointed the memory already initialized must be valid.
 /// Makesure the memory shouldn't be dropped while whose pointer is being used.
 #[no_mangle]
-pub unsafe extern "C" fn CircleStreamBufferCopyDataToBegin(object: *mut StreamBuffer) -> i32 {
-    info!(LOG_LABEL, "enter CircleStreamBufferCopyDataToBegin");
-    if let Some(obj) = StreamBuffer::as_mut(object) {
-        obj.copy_data_to_begin();
-        BufferStatusCode::Ok.into()
+pub unsafe extern "C" fn CircleStreamBufferWrite(object: *mut CircleStreamBuffer, buf: *const c_char,
+    size: usize) -> bool {
+    info!(LOG_LABEL, "enter CircleStreamBufferWrite");
+    if let Some(obj) = CircleStreamBuffer::as_mut(object) {
+        obj.write(buf, size)
     } else {
-        BufferStatusCode::CopyDataToBeginFail.into()
+        false
     }
 }
-/// Read sz_buf to buf.
+/// Copy size unread bytes starting at offset into buf without consuming them.
 ///
 /// # Safety
 ///
 /// The pointer which pointed the memory already initialized must be valid.
 /// Makesure the memory shouldn't be dropped while whose pointer is being used.
 #[no_mangle]
-pub unsafe extern "C" fn StreamBufferReadChar(object: *mut StreamBuffer, buf: *const c_char, size: usize) -> bool {
-    info!(LOG_LABEL, "enter StreamBufferReadChar");
-    if let Some(obj) = StreamBuffer::as_mut(object) {
-        obj.read_char_usize(buf, size)
+pub unsafe extern "C" fn CircleStreamBufferPeek(object: *const CircleStreamBuffer, offset: usize,
+    buf: *mut c_char, size: usize) -> bool {
+    if let Some(obj) = CircleStreamBuffer::as_ref(object) {
+        obj.peek(offset, buf, size)
     } else {
         false
     }
 }
-/// Write sz_buf to buf.
+/// Consume n unread bytes.
 ///
 /// # Safety
 ///
 /// The pointer which pointed the memory already initialized must be valid.
 /// Makesure the memory shouldn't be dropped while whose pointer is being used.
 #[no_mangle]
-pub unsafe extern "C" fn CircleStreamBufferWrite(object: *mut StreamBuffer, buf: *const c_char, size: usize) -> bool {
-    info!(LOG_LABEL, "enter CircleStreamBufferWrite");
-    if let Some(obj) = StreamBuffer::as_mut(object) {
-        obj.circle_write(buf, size)
+pub unsafe extern "C" fn CircleStreamBufferSeekReadPos(object: *mut CircleStreamBuffer, n: usize) -> bool {
+    if let Some(obj) = CircleStreamBuffer::as_mut(object) {
+        obj.seek_read_pos(n)
     } else {
         false
     }
 }
+/// Drop all unread bytes.
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferReset(object: *mut CircleStreamBuffer) -> i32 {
+    if let Some(obj) = CircleStreamBuffer::as_mut(object) {
+        obj.reset();
+        BufferStatusCode::Ok.into()
+    } else {
+        BufferStatusCode::ResetFail.into()
+    }
+}
+/// Obtain the number of unread bytes.
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferUnreadSize(object: *const CircleStreamBuffer) -> usize {
+    if let Some(obj) = CircleStreamBuffer::as_ref(object) {
+        obj.unread_size()
+    } else {
+        0
+    }
+}
+/// Obtain the number of unread bytes readable before the ring wraps.
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferContiguousReadSize(object: *const CircleStreamBuffer) -> usize {
+    if let Some(obj) = CircleStreamBuffer::as_ref(object) {
+        obj.contiguous_read_size()
+    } else {
+        0
+    }
+}
+/// Obtain the ring capacity.
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferCapacity(object: *const CircleStreamBuffer) -> usize {
+    if let Some(obj) = CircleStreamBuffer::as_ref(object) {
+        obj.capacity()
+    } else {
+        0
+    }
+}
+/// Obtain the address of the first unread byte.
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn CircleStreamBufferReadBuf(object: *const CircleStreamBuffer) -> *const c_char {
+    if let Some(obj) = CircleStreamBuffer::as_ref(object) {
+        obj.read_buf()
+    } else {
+        std::ptr::null()
+    }
+}
 /// read packets on client.
 ///
 /// # Safety
@@ -265,10 +372,10 @@ pub unsafe extern "C" fn CircleStreamBufferWrite(object: *mut StreamBuffer, buf:
 /// The pointer which pointed the memory already initialized must be valid.
 /// Makesure the memory shouldn't be dropped while whose pointer is being used.
 #[no_mangle]
-pub unsafe extern "C" fn ReadClientPackets(object: *mut StreamBuffer, stream_client: *const CSensorServiceClient,
-    callback_fun: ClientPacketCallBackFun) -> i32 {
+pub unsafe extern "C" fn ReadClientPackets(object: *mut CircleStreamBuffer,
+    stream_client: *const CSensorServiceClient, callback_fun: ClientPacketCallBackFun) -> i32 {
     info!(LOG_LABEL,"enter ReadClientPackets");
-    if let Some(obj) = StreamBuffer::as_mut(object) {
+    if let Some(obj) = CircleStreamBuffer::as_mut(object) {
         obj.read_client_packets(stream_client, callback_fun);
         BufferStatusCode::Ok.into()
     } else {
@@ -17,15 +17,13 @@
 pub mod ffi;
 use hilog_rust::{debug, error, hilog, HiLogLabel, LogType};
 use libc::c_int;
-use std::{ffi::{CString, c_char}, thread::sleep, time::Duration};
+use std::ffi::{CString, c_char};
 const LOG_LABEL: HiLogLabel = HiLogLabel {
     log_type: LogType::LogCore,
     domain: 0xD002700,
     tag: "StreamSession"
 };
 const MAX_PACKET_BUF_SIZE: usize = 256;
-const SEND_RETRY_LIMIT: i32 = 32;
-const SEND_RETRY_SLEEP_TIME: u64 = 10000;
 const RET_ERR: i32 = -1;
 
 #[repr(C)]
@@ -118,45 +116,41 @@ impl StreamSession {
             error!(LOG_LABEL, "size is either equal to 0 or greater than MAX_PACKET_BUF_SIZE, size: {}", size);
             return false;
         }
+        let iov = [libc::iovec { iov_base: buf as *mut libc::c_void, iov_len: size }];
+        self.session_try_send_iov(&iov) == size as isize
+    }
+
+    /// Sends as much of iov as the socket accepts with a single non-blocking sendmsg. Returns the number of
+    /// bytes sent, 0 when the socket is full and -1 on error. Unsent bytes are left to the caller to queue.
+    fn session_try_send_iov(&self, iov: &[libc::iovec]) -> isize {
+        if iov.is_empty() {
+            error!(LOG_LABEL, "iov is empty");
+            return RET_ERR as isize;
+        }
         if self.fd < 0 {
             error!(LOG_LABEL, "The fd is less than 0, fd: {}", self.fd);
-            return false;
+            return RET_ERR as isize;
         }
-        let mut idx: usize = 0;
-        let mut retry_count: i32 = 0;
-        let buf_size = size;
-        let mut rem_size = buf_size;
-        while rem_size > 0 && retry_count < SEND_RETRY_LIMIT {
-            retry_count += 1;
-            // SAFETY: call extern libc library function
-            let count = unsafe {
-                libc::send(self.fd as c_int, buf.add(idx) as *const libc::c_void, rem_size,
-                libc::MSG_DONTWAIT | libc::MSG_NOSIGNAL)
-            };
-            // SAFETY: call extern libc library function
-            let errno = unsafe {
-                *libc::__errno_location()
-            };
-            if count < 0 {
-                if errno == libc::EAGAIN || errno == libc::EINTR || errno == libc::EWOULDBLOCK {
-                    sleep(Duration::from_micros(SEND_RETRY_SLEEP_TIME));
-                    error!(LOG_LABEL, "Continue for errno EAGAIN|EINTR|EWOULDBLOCK, errno:{}", errno);
-                    continue;
-                }
-                error!(LOG_LABEL, "Send return failed,error:{} fd:{}", errno, self.fd);
-                return false;
-            }
-            idx += count as usize;
-            rem_size -= count as usize;
-            if rem_size > 0 {
-                sleep(Duration::from_micros(SEND_RETRY_SLEEP_TIME));
-            }
+        // SAFETY: msghdr is plain data, zero is a valid initial state
+        let mut msg: libc::msghdr = unsafe { std::mem::zeroed() };
+        msg.msg_iov = iov.as_ptr() as *mut libc::iovec;
+        msg.msg_iovlen = iov.len() as _;
+        // SAFETY: call extern libc library function
+        let count = unsafe {
+            libc::sendmsg(self.fd as c_int, &msg, libc::MSG_DONTWAIT | libc::MSG_NOSIGNAL)
+        };
+        if count >= 0 {
+            return count;
         }
-        if retry_count >= SEND_RETRY_LIMIT || rem_size != 0 {
-            error!(LOG_LABEL, "Send too many times:{}/{},size:{}/{} fd:{}",
-                retry_count, SEND_RETRY_LIMIT, idx, buf_size, self.fd);
-            return false;
+        // SAFETY: call extern libc library function
+        let errno = unsafe {
+            *libc::__errno_location()
+        };
+        if errno == libc::EAGAIN || errno == libc::EINTR || errno == libc::EWOULDBLOCK {
+            debug!(LOG_LABEL, "Socket is full, errno:{}", errno);
+            return 0;
         }
-        true
+        error!(LOG_LABEL, "Send return failed,error:{} fd:{}", errno, self.fd);
+        RET_ERR as isize
     }
 }
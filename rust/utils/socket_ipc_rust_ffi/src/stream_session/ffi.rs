@@ -209,6 +209,25 @@ pub unsafe extern "C" fn StreamSessionClose(object: *mut StreamSession) -> i32 {
     }
 }
 
+/// Try to send the buffers described by iov once via StreamSessions, returns the number of bytes sent
+///
+/// # Safety
+///
+/// The pointer which pointed the memory already initialized must be valid.
+/// iov must point to iov_count initialized entries.
+/// Makesure the memory shouldn't be dropped while whose pointer is being used.
+#[no_mangle]
+pub unsafe extern "C" fn StreamSessionTrySendIov(object: *const StreamSession, iov: *const libc::iovec,
+    iov_count: usize) -> isize {
+    if iov.is_null() || iov_count == 0 {
+        return RET_ERR as isize;
+    }
+    if let Some(obj) = StreamSession::as_ref(object) {
+        obj.session_try_send_iov(std::slice::from_raw_parts(iov, iov_count))
+    } else {
+        RET_ERR as isize
+    }
+}
 /// Send message via StreamSessions
 ///
 /// # Safety
@@ -46,6 +46,7 @@ private:
     std::unique_ptr<ISensorHdiConnection> iSensorCompatibleHdiConnection_ { nullptr };
     std::mutex sensorMutex_;
     std::vector<Sensor> sensorList_;
+    std::unordered_set<SensorDescription> sensorIndex_;
     std::unordered_set<int32_t> sensorSet_;
     std::unordered_set<int32_t> mockSet_;
     int32_t ConnectHdiService();
@@ -57,6 +58,7 @@ private:
     Sensor GenerateHeadPostureSensor();
     Sensor GenerateProximitySensor();
     void UpdateSensorList(std::vector<Sensor> &singleDevSensors);
+    void RebuildSensorIndex();
     std::atomic_bool hdiConnectionStatus_ = false;
 };
 } // namespace Sensors
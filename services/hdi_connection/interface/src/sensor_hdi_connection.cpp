@@ -100,6 +100,7 @@ int32_t SensorHdiConnection::ConnectHdiService()
     for (const auto &sensor : sensorList_) {
         sensorSet_.insert(sensor.GetSensorTypeId());
     }
+    RebuildSensorIndex();
     return ERR_OK;
 }
 
@@ -221,6 +222,7 @@ int32_t SensorHdiConnection::GetSensorList(std::vector<Sensor> &sensorList)
         if (iSensorHdiConnection_->GetSensorList(sensorList_) != ERR_OK) {
             SEN_HILOGW("Get sensor list failed");
         }
+        RebuildSensorIndex();
     }
     sensorList.assign(sensorList_.begin(), sensorList_.end());
 #ifdef BUILD_VARIANT_ENG
@@ -443,25 +445,28 @@ int32_t SensorHdiConnection::DestroyHdiConnection()
     return ret;
 }
 
+void SensorHdiConnection::RebuildSensorIndex()
+{
+    sensorIndex_.clear();
+    for (const auto &sensor : sensorList_) {
+        sensorIndex_.insert({
+            sensor.GetDeviceId(), sensor.GetSensorTypeId(), sensor.GetSensorId(), sensor.GetLocation()
+        });
+    }
+}
+
 void SensorHdiConnection::UpdateSensorList(std::vector<Sensor> &singleDevSensors)
 {
     CALL_LOG_ENTER;
-    for (const auto& newSensor : singleDevSensors) {
-        bool found = false;
-        for (const auto& oldSensor : sensorList_) {
-            if (oldSensor.GetDeviceId() == newSensor.GetDeviceId() &&
-                oldSensor.GetSensorId() == newSensor.GetSensorId() &&
-                oldSensor.GetSensorTypeId() == newSensor.GetSensorTypeId()) {
-                found = true;
-                break;
-            }
-        }
-        if (!found) {
+    for (const auto &newSensor : singleDevSensors) {
+        SensorDescription sensorDesc = {
+            newSensor.GetDeviceId(), newSensor.GetSensorTypeId(), newSensor.GetSensorId(), newSensor.GetLocation()
+        };
+        if (sensorIndex_.insert(sensorDesc).second) {
             SEN_HILOGD("Sensor not found in sensorList_");
             sensorList_.push_back(newSensor);
         }
     }
-    return;
 }
 
 int32_t SensorHdiConnection::GetSensorListByDevice(int32_t deviceId, std::vector<Sensor> &singleDevSensors)
@@ -545,16 +550,21 @@ bool SensorHdiConnection::PlugEraseSensorData(const SensorPlugInfo &info)
         SEN_HILOGE("sensorList_ cannot be empty");
         return false;
     }
+    SensorDescription sensorDesc = {
+        info.deviceSensorInfo.deviceId, info.deviceSensorInfo.sensorType,
+        info.deviceSensorInfo.sensorId, info.deviceSensorInfo.location
+    };
+    if (sensorIndex_.erase(sensorDesc) == 0) {
+        SEN_HILOGD("sensorList_ cannot find the sensor");
+        return true;
+    }
     auto it = std::find_if(sensorList_.begin(), sensorList_.end(), [&](const Sensor& sensor) {
-        return sensor.GetDeviceId() == info.deviceSensorInfo.deviceId &&
-            sensor.GetSensorTypeId() == info.deviceSensorInfo.sensorType &&
-            sensor.GetSensorId() == info.deviceSensorInfo.sensorId;
+        return sensor.GetDeviceId() == sensorDesc.deviceId && sensor.GetSensorTypeId() == sensorDesc.sensorType &&
+            sensor.GetSensorId() == sensorDesc.sensorId && sensor.GetLocation() == sensorDesc.location;
     });
     if (it != sensorList_.end()) {
         sensorList_.erase(it);
-        return true;
     }
-    SEN_HILOGD("sensorList_ cannot find the sensor");
     return true;
 }
 } // namespace Sensors
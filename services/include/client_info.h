@@ -51,10 +51,14 @@ public:
     void ClearSensorInfo(const SensorDescription &sensorDesc);
     void ClearCurPidSensorInfo(const SensorDescription &sensorDesc, int32_t pid);
     bool DestroySensorChannel(int32_t pid);
+    void MarkSensorChannelDead(int32_t pid);
     void DestroyAppThreadInfo(int32_t pid);
     SensorBasicInfo GetCurPidSensorInfo(const SensorDescription &sensorDesc, int32_t pid);
     uint64_t ComputeBestPeriodCount(const SensorDescription &sensorDesc, sptr<SensorBasicDataChannel> &channel);
     uint64_t ComputeBestFifoCount(const SensorDescription &sensorDesc, sptr<SensorBasicDataChannel> &channel);
+    int64_t ComputeCoalesceWindow(const SensorDescription &sensorDesc, sptr<SensorBasicDataChannel> &channel);
+    bool SetCoalesceWindow(const SensorDescription &sensorDesc, int32_t pid, int64_t windowNs);
+    int32_t ComputeChannelBufferSize(int32_t pid);
     int32_t GetStoreEvent(const SensorDescription &sensorDesc, SensorData &data);
     void StoreEvent(const SensorData &data);
     void ClearEvent();
@@ -16,6 +16,8 @@
 #ifndef SENSORS_DATA_PROCESSER_H
 #define SENSORS_DATA_PROCESSER_H
 
+#include <memory>
+
 #include "fifo_cache_data.h"
 #include "flush_info_record.h"
 #include "sensor_hdi_connection.h"
@@ -31,6 +33,8 @@ public:
     static int DataThread(sptr<SensorDataProcesser> dataProcesser, sptr<ReportDataCallback> dataCallback);
     int32_t CacheSensorEvent(const SensorData &data, sptr<SensorBasicDataChannel> &channel);
     void UpdateSensorMap(const std::unordered_map<SensorDescription, Sensor> &sensorMap);
+    void AddSensors(const std::vector<Sensor> &sensors);
+    void RemoveSensor(const SensorDescription &sensorDesc);
 
 private:
     DISALLOW_COPY_AND_MOVE(SensorDataProcesser);
@@ -44,14 +48,25 @@ private:
                            uint64_t fifoCount);
     void SendRawData(std::unordered_map<SensorDescription, SensorData> &cacheBuf, sptr<SensorBasicDataChannel> channel,
                      std::vector<SensorData> events);
+    void CoalesceData(std::unordered_map<SensorDescription, SensorData> &cacheBuf,
+                      sptr<SensorBasicDataChannel> &channel, const SensorData &data, int64_t window);
+    void FlushCoalescedData();
     void EventFilter(CircularEventBuf &eventsBuf);
     void UpdataFifoDataChannel(sptr<SensorBasicDataChannel> &channel, std::vector<sptr<FifoCacheData>> &dataCount);
+    std::shared_ptr<const std::unordered_map<SensorDescription, Sensor>> GetSensorMap() const;
+    void PublishSensorMap(std::shared_ptr<const std::unordered_map<SensorDescription, Sensor>> sensorMap);
     ClientInfo &clientInfo_ = ClientInfo::GetInstance();
     FlushInfoRecord &flushInfo_ = FlushInfoRecord::GetInstance();
     std::mutex dataCountMutex_;
     std::unordered_map<SensorDescription, std::vector<sptr<FifoCacheData>>> dataCountMap_;
+    /**
+     * sensorMap_ is an immutable snapshot replaced as a whole on hotplug. The dispatch thread only
+     * loads the pointer, writers serialize on sensorMutex_ and publish a modified copy.
+     */
     std::mutex sensorMutex_;
-    std::unordered_map<SensorDescription, Sensor> sensorMap_;
+    std::shared_ptr<const std::unordered_map<SensorDescription, Sensor>> sensorMap_;
+    std::vector<sptr<SensorBasicDataChannel>> coalescedChannels_;
+    int64_t nextFlushTime_ = 0;
 };
 } // namespace Sensors
 } // namespace OHOS
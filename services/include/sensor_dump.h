@@ -19,6 +19,7 @@
 #include "client_info.h"
 #include "sensor.h"
 #include "sensor_agent_type.h"
+#include "stream_server.h"
 
 namespace OHOS {
 namespace Sensors {
@@ -27,12 +28,16 @@ public:
     SensorDump() = default;
     virtual ~SensorDump() = default;
     void ParseCommand(int32_t fd, const std::vector<std::string> &args, const std::vector<Sensor> &sensors,
-        ClientInfo &clientInfo);
+        const std::vector<SessionInfo> &sessionInfo, ClientInfo &clientInfo);
     void DumpHelp(int32_t fd);
     bool DumpSensorList(int32_t fd, const std::vector<Sensor> &sensors);
     bool DumpSensorChannel(int32_t fd, ClientInfo &clientInfo);
     bool DumpOpeningSensor(int32_t fd, const std::vector<Sensor> &sensors, ClientInfo &clientInfo);
     bool DumpSensorData(int32_t fd, ClientInfo &clientInfo);
+    bool DumpStartupTime(int32_t fd);
+    bool DumpSession(int32_t fd, const std::vector<SessionInfo> &sessionInfo);
+    void RecordStartupPhase(const std::string &phase, int64_t durationMs);
+    void ClearStartupPhases();
 
 private:
     DISALLOW_COPY_AND_MOVE(SensorDump);
@@ -42,7 +47,10 @@ private:
     static std::unordered_map<int32_t, std::string> sensorMap_;
     void RunSensorDump(int32_t fd, int32_t optionIndex, const std::vector<std::string> &args, char **argv);
     std::vector<Sensor> sensors_;
+    std::vector<SessionInfo> sessionInfo_;
     ClientInfo &clientInfo_ = ClientInfo::GetInstance();
+    std::mutex startupMutex_;
+    std::vector<std::pair<std::string, int64_t>> startupPhases_;
 };
 } // namespace Sensors
 } // namespace OHOS
@@ -16,7 +16,10 @@
 #ifndef SENSOR_MANAGER_H
 #define SENSOR_MANAGER_H
 
+#include <chrono>
+#include <condition_variable>
 #include <thread>
+#include <unordered_set>
 
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
 #include "sensor_data_processer.h"
@@ -36,6 +39,8 @@ public:
     bool SetBestSensorParams(const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
     bool ResetBestSensorParams(const SensorDescription &sensorDesc);
     void StartDataReportThread();
+    void StopReconfigThread();
+    uint32_t GetBatchCount(const SensorDescription &sensorDesc);
 #else
     void InitSensorMap(const std::unordered_map<SensorDescription, Sensor> &sensorMap);
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
@@ -49,10 +54,27 @@ public:
 
 private:
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    struct BatchParams {
+        int64_t samplingPeriodNs = 0;
+        int64_t maxReportDelayNs = 0;
+        uint32_t batchCount = 0;
+    };
+    bool ApplySensorParams(const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
+    void ScheduleReconfig(const SensorDescription &sensorDesc);
+    void ReconfigThread();
     SensorHdiConnection &sensorHdiConnection_ = SensorHdiConnection::GetInstance();
     std::thread dataThread_;
     sptr<SensorDataProcesser> sensorDataProcesser_ = nullptr;
     sptr<ReportDataCallback> reportDataCallback_ = nullptr;
+    std::mutex batchMutex_;
+    std::condition_variable reconfigCondition_;
+    std::unordered_map<SensorDescription, BatchParams> appliedParams_;
+    std::unordered_map<SensorDescription, std::chrono::steady_clock::time_point> pendingReconfig_;
+    std::unordered_set<SensorDescription> forcedReconfig_;
+    // persist.sensor.reconfig_window_ms, how long relaxing the HDI batch params is deferred to coalesce changes
+    std::chrono::milliseconds reconfigWindow_ { 0 };
+    std::thread reconfigThread_;
+    bool reconfigStop_ = false;
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
     ClientInfo &clientInfo_ = ClientInfo::GetInstance();
     std::unordered_map<SensorDescription, Sensor> sensorMap_;
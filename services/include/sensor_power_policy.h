@@ -16,6 +16,10 @@
 #ifndef SENSOR_POWER_POLICY_H
 #define SENSOR_POWER_POLICY_H
 
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
 #include "active_info.h"
 #include "sensor_agent_type.h"
 #include "sensor_manager.h"
@@ -30,21 +34,35 @@ class SensorPowerPolicy : public Singleton<SensorPowerPolicy> {
 public:
     ErrCode SuspendSensors(int32_t pid);
     ErrCode ResumeSensors(int32_t pid);
+    ErrCode SuspendSensors(const std::vector<int32_t> &pids);
+    ErrCode ResumeSensors(const std::vector<int32_t> &pids);
     ErrCode ResetSensors();
     std::vector<ActiveInfo> GetActiveInfoList(int32_t pid);
     void ReportActiveInfo(const ActiveInfo &activeInfo, const std::vector<SessionPtr> &sessionList);
     void DeleteDeathPidSensorInfo(int32_t pid);
+    void StartActiveInfoSender();
+    void StopActiveInfoSender();
 
 private:
     bool CheckFreezingSensor(int32_t sensorType);
-    bool Suspend(int32_t pid, const std::vector<SensorDescription> &sensorDescList,
-        std::unordered_map<SensorDescription, SensorBasicInfo> &SensorInfoMap);
+    bool SuspendPidLocked(int32_t pid, std::vector<SensorDescription> &disableList,
+        std::vector<SensorDescription> &resetList);
+    bool ApplySuspendLocked(const std::vector<SensorDescription> &disableList,
+        std::vector<SensorDescription> &resetList);
     bool Resume(int32_t pid, const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
     ErrCode RestoreSensorInfo(int32_t pid, const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
         int64_t maxReportDelayNs);
+    bool CheckResumeParams(const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
     std::vector<int32_t> GetSuspendPidList();
+    void ActiveInfoSenderThread();
+    void SendActiveInfoQueue(const SessionPtr &session, std::deque<ActiveInfo> &infos);
     std::mutex pidSensorInfoMutex_;
     std::unordered_map<int32_t, std::unordered_map<SensorDescription, SensorBasicInfo>> pidSensorInfoMap_;
+    std::mutex activeInfoMutex_;
+    std::condition_variable activeInfoCondition_;
+    std::unordered_map<SessionPtr, std::deque<ActiveInfo>> activeInfoQueueMap_;
+    std::thread activeInfoSenderThread_;
+    bool activeInfoSenderStop_ = false;
 };
 } // namespace Sensors
 } // namespace OHOS
@@ -16,9 +16,15 @@
 #ifndef SENSOR_SERVICE_H
 #define SENSOR_SERVICE_H
 
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <unordered_set>
+
 #include "system_ability.h"
 
 #include "death_recipient_template.h"
+#include "sensor_catalog.h"
 #include "sensor_delayed_sp_singleton.h"
 #include "sensor_power_policy.h"
 #include "sensor_service_stub.h"
@@ -46,13 +52,20 @@ public:
     ErrCode EnableSensor(const SensorDescriptionIPC &sensorDesc, int64_t samplingPeriodNs,
         int64_t maxReportDelayNs) override;
     ErrCode DisableSensor(const SensorDescriptionIPC &sensorDesc) override;
+    ErrCode EnableSensors(const std::vector<SensorEnableInfoIPC> &enableInfos,
+        std::vector<int32_t> &results) override;
+    ErrCode DisableSensors(const std::vector<SensorDescriptionIPC> &sensorDescs,
+        std::vector<int32_t> &results) override;
     ErrCode GetSensorList(std::vector<Sensor> &sensorList) override;
     ErrCode GetSensorListByDevice(int32_t deviceId, std::vector<Sensor> &sensorList) override;
+    ErrCode GetSensorCatalog(int32_t &catalogFd) override;
     ErrCode TransferDataChannel(int32_t sendFd, const sptr<IRemoteObject> &sensorClient) override;
     ErrCode DestroySensorChannel(const sptr<IRemoteObject> &sensorClient) override;
     void ProcessDeathObserver(const wptr<IRemoteObject> &object);
     ErrCode SuspendSensors(int32_t pid) override;
     ErrCode ResumeSensors(int32_t pid) override;
+    ErrCode SuspendSensorsBatch(const std::vector<int32_t> &pids) override;
+    ErrCode ResumeSensorsBatch(const std::vector<int32_t> &pids) override;
     ErrCode GetActiveInfoList(int32_t pid, std::vector<ActiveInfo> &activeInfoList) override;
     ErrCode CreateSocketChannel(const sptr<IRemoteObject> &sensorClient, int32_t &clientFd) override;
     ErrCode DestroySocketChannel(const sptr<IRemoteObject> &sensorClient) override;
@@ -62,6 +75,7 @@ public:
     ErrCode SetDeviceStatus(uint32_t deviceStatus) override;
     ErrCode TransferClientRemoteObject(const sptr<IRemoteObject> &sensorClient) override;
     ErrCode DestroyClientRemoteObject(const sptr<IRemoteObject> &sensorClient) override;
+    ErrCode SetCoalesceWindow(const SensorDescriptionIPC &sensorDesc, int64_t windowNs) override;
 
 private:
     DISALLOW_COPY_AND_MOVE(SensorService);
@@ -72,6 +86,7 @@ private:
     ErrCode CheckAuthAndParameter(const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
         int64_t maxReportDelayNs);
     void ReportPlugEventCallback(const SensorPlugInfo &sensorPlugInfo);
+    void InvalidateSensorCatalog();
     ErrCode SensorReportEvent(const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs,
         int32_t pid);
 
@@ -92,12 +107,25 @@ private:
     void ReportSensorSysEvent(int32_t sensorType, bool enable, int32_t pid, int64_t samplingPeriodNs = 0,
         int64_t maxReportDelayNs = 0);
     ErrCode DisableSensor(const SensorDescription &sensorDesc, int32_t pid);
+    ErrCode DisableSensorInner(const SensorDescription &sensorDesc, int32_t pid);
+    ErrCode EnableSensorInner(const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
+        int64_t maxReportDelayNs, int32_t pid);
+    ErrCode CheckDisableAuth(const SensorDescription &sensorDesc);
+    void ResetCritical();
+    void UpdateChannelBufferSize(int32_t pid);
     bool RegisterPermCallback(int32_t sensorType);
     void UnregisterPermCallback();
     bool CheckSensorId(const SensorDescription &sensorDesc);
     void ReportActiveInfo(const SensorDescription &sensorDesc, int32_t pid);
     bool IsSystemServiceCalling();
     bool IsSystemCalling();
+    ErrCode CheckManageSensorAuth();
+    bool WaitHdiReady();
+    bool IsHdiReady();
+    void SetHdiReady();
+    void TeardownThread();
+    void StopTeardownThread();
+    void TeardownClient(int32_t pid, sptr<IRemoteObject> client);
     bool IsNeedLoadMotionLib();
     void SetCritical();
     void LoadMotionTransform(int32_t systemAbilityId);
@@ -106,12 +134,21 @@ private:
     std::mutex sensorsMutex_;
     std::mutex sensorMapMutex_;
     std::vector<Sensor> sensors_;
+    std::unordered_set<int32_t> unknownDeviceIds_;
     std::unordered_map<SensorDescription, Sensor> sensorMap_;
+    std::mutex catalogMutex_;
+    int32_t catalogFd_ = -1;
+    SensorCatalogView catalogView_;
+    uint64_t catalogGeneration_ = 0;
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
     bool InitInterface();
     bool InitDataCallback();
     bool InitSensorList();
     bool InitPlugCallback();
+    bool LoadSensorListCache();
+    bool SetSensorList(const std::vector<Sensor> &sensors);
+    void InitHdi();
+    std::thread startupThread_;
     SensorHdiConnection &sensorHdiConnection_ = SensorHdiConnection::GetInstance();
     sptr<SensorDataProcesser> sensorDataProcesser_ = nullptr;
     sptr<ReportDataCallback> reportDataCallback_ = nullptr;
@@ -122,6 +159,14 @@ private:
     // death recipient of sensor client
     std::mutex clientDeathObserverMutex_;
     sptr<IRemoteObject::DeathRecipient> clientDeathObserver_ = nullptr;
+    std::mutex startupMutex_;
+    std::condition_variable startupCondition_;
+    bool isHdiReady_ = false;
+    std::mutex teardownMutex_;
+    std::condition_variable teardownCondition_;
+    std::deque<std::pair<int32_t, sptr<IRemoteObject>>> teardownQueue_;
+    std::thread teardownThread_;
+    bool teardownStop_ = false;
     std::shared_ptr<PermStateChangeCb> permStateChangeCb_ = nullptr;
     ErrCode SaveSubscriber(const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
     std::atomic_bool isReportActiveInfo_ = false;
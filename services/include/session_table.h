@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SESSION_TABLE_H
+#define SESSION_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "stream_session.h"
+
+namespace OHOS {
+namespace Sensors {
+/**
+ * Session table indexed by fd and by pid. Both indexes are split into shards with their own lock, so lookups
+ * for different clients do not serialize on a single mutex.
+ */
+class SessionTable {
+public:
+    SessionTable() = default;
+    ~SessionTable() = default;
+    bool Insert(SessionPtr sess);
+    SessionPtr FindByFd(int32_t fd);
+    SessionPtr FindByPid(int32_t pid);
+    SessionPtr EraseByPid(int32_t pid);
+    std::vector<SessionPtr> GetAll();
+    std::vector<SessionPtr> Clear();
+    size_t Size() const;
+    DISALLOW_COPY_AND_MOVE(SessionTable);
+
+private:
+    static constexpr size_t SHARD_COUNT = 16;
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<int32_t, SessionPtr> sessions;
+    };
+    Shard &GetShard(std::array<Shard, SHARD_COUNT> &shards, int32_t key);
+    std::array<Shard, SHARD_COUNT> fdShards_;
+    std::array<Shard, SHARD_COUNT> pidShards_;
+    std::atomic<size_t> count_ { 0 };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // SESSION_TABLE_H
@@ -16,13 +16,27 @@
 #ifndef STREAM_SERVER_H
 #define STREAM_SERVER_H
 
+#include <atomic>
+#include <map>
 #include <mutex>
+#include <thread>
 
+#include "sensor_basic_data_channel.h"
+#include "session_table.h"
 #include "stream_session.h"
 #include "stream_socket.h"
 
 namespace OHOS {
 namespace Sensors {
+struct SessionInfo {
+    int32_t fd { -1 };
+    int32_t pid { -1 };
+    int32_t uid { -1 };
+    std::string programName;
+    size_t memorySize { 0 };
+    size_t outputSize { 0 };
+};
+
 class StreamServer : public StreamSocket {
 public:
     StreamServer() = default;
@@ -32,13 +46,30 @@ public:
     SessionPtr GetSession(int32_t fd);
     SessionPtr GetSessionByPid(int32_t pid);
     int32_t AddSocketPairInfo(int32_t uid, int32_t pid, int32_t tokenType, int32_t &serverFd, int32_t &clientFd);
+    bool AddDataChannel(const sptr<SensorBasicDataChannel> &channel);
+    void DelDataChannel(const sptr<SensorBasicDataChannel> &channel);
+    void GetSessionInfo(std::vector<SessionInfo> &sessionInfo);
 
 protected:
     bool AddSession(SessionPtr sess);
     void DelSession(int32_t pid);
-    std::mutex sessionMutex_;
-    std::map<int32_t, int32_t> idxPidMap_;
-    std::map<int32_t, SessionPtr> sessionsMap_;
+    bool StartReactorLocked();
+    void StartReactor();
+    void StopReactor();
+    void ReactorThread(int32_t reactorFd, int32_t wakeupFd);
+    void OnReactorEvent(int32_t fd, uint32_t events);
+    bool AddReactorFd(int32_t fd, uint32_t events);
+    void DelReactorFd(int32_t fd);
+    void WatchWritable(int32_t fd, uint32_t events, bool watchWritable);
+    SessionTable sessionTable_;
+    std::mutex reactorMutex_;
+    std::atomic_bool reactorRunning_ { false };
+    bool reactorStopped_ { false };
+    std::thread reactorThread_;
+    int32_t reactorFd_ { -1 };
+    int32_t wakeupFd_ { -1 };
+    std::mutex dataChannelMutex_;
+    std::map<int32_t, wptr<SensorBasicDataChannel>> dataChannelMap_;
 };
 } // namespace Sensors
 } // namespace OHOS
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "i_sensor_client.h"
 #include "permission_util.h"
 #include "securec.h"
@@ -37,6 +39,7 @@ constexpr int32_t MIN_MAP_SIZE = 0;
 constexpr uint32_t NO_STORE_EVENT = -2;
 constexpr uint32_t MAX_SUPPORT_CHANNEL = 200;
 constexpr uint32_t MAX_DUMP_DATA_SIZE = 10;
+constexpr int64_t CHANNEL_STALL_TOLERANCE_NS = 200000000;
 } // namespace
 
 std::unordered_map<std::string, std::set<int32_t>> ClientInfo::userGrantPermMap_ = {
@@ -258,7 +261,9 @@ bool ClientInfo::UpdateSensorInfo(const SensorDescription &sensorDesc, int32_t p
         auto ret = it->second.insert(std::make_pair(pid, sensorInfo));
         return ret.second;
     }
-    it->second[pid] = sensorInfo;
+    int64_t coalesceWindowNs = pidIt->second.GetCoalesceWindowNs();
+    pidIt->second = sensorInfo;
+    pidIt->second.SetCoalesceWindowNs(coalesceWindowNs);
     SEN_HILOGI("Done, sensorType:%{public}d, pid:%{public}d", sensorDesc.sensorType, pid);
     return true;
 }
@@ -346,6 +351,16 @@ void ClientInfo::ClearCurPidSensorInfo(const SensorDescription &sensorDesc, int3
     SEN_HILOGI("Done, sensorType:%{public}d, pid:%{public}d", sensorDesc.sensorType, pid);
 }
 
+void ClientInfo::MarkSensorChannelDead(int32_t pid)
+{
+    std::lock_guard<std::mutex> channelLock(channelMutex_);
+    auto channelIt = channelMap_.find(pid);
+    if ((channelIt == channelMap_.end()) || (channelIt->second == nullptr)) {
+        return;
+    }
+    channelIt->second->SetDead();
+}
+
 bool ClientInfo::DestroySensorChannel(int32_t pid)
 {
     CALL_LOG_ENTER;
@@ -403,6 +418,7 @@ SensorBasicInfo ClientInfo::GetCurPidSensorInfo(const SensorDescription &sensorD
     }
     sensorInfo.SetSamplingPeriodNs(pidIt->second.GetSamplingPeriodNs());
     sensorInfo.SetMaxReportDelayNs(pidIt->second.GetMaxReportDelayNs());
+    sensorInfo.SetCoalesceWindowNs(pidIt->second.GetCoalesceWindowNs());
     return sensorInfo;
 }
 
@@ -456,6 +472,65 @@ uint64_t ClientInfo::ComputeBestFifoCount(const SensorDescription &sensorDesc, s
     return (ret <= 0L) ? 0UL : ret;
 }
 
+int64_t ClientInfo::ComputeCoalesceWindow(const SensorDescription &sensorDesc, sptr<SensorBasicDataChannel> &channel)
+{
+    if (sensorDesc.sensorType == INVALID_SENSOR_ID || channel == nullptr) {
+        SEN_HILOGE("sensorType is invalid or channel cannot be null");
+        return 0L;
+    }
+    int32_t pid = INVALID_PID;
+    {
+        std::lock_guard<std::mutex> channelLock(channelMutex_);
+        for (const auto &channelIt : channelMap_) {
+            if (channelIt.second == channel) {
+                pid = channelIt.first;
+            }
+        }
+    }
+    int64_t windowNs = GetCurPidSensorInfo(sensorDesc, pid).GetCoalesceWindowNs();
+    return (windowNs <= 0L) ? 0L : windowNs;
+}
+
+bool ClientInfo::SetCoalesceWindow(const SensorDescription &sensorDesc, int32_t pid, int64_t windowNs)
+{
+    if ((sensorDesc.sensorType == INVALID_SENSOR_ID) || (pid <= INVALID_PID) || (windowNs < 0L)) {
+        SEN_HILOGE("Params are invalid");
+        return false;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    auto it = clientMap_.find(sensorDesc);
+    if (it == clientMap_.end()) {
+        SEN_HILOGE("Sensor is not enabled, sensorType:%{public}d", sensorDesc.sensorType);
+        return false;
+    }
+    auto pidIt = it->second.find(pid);
+    if (pidIt == it->second.end()) {
+        SEN_HILOGE("Sensor is not enabled by pid:%{public}d", pid);
+        return false;
+    }
+    pidIt->second.SetCoalesceWindowNs(windowNs);
+    return true;
+}
+
+int32_t ClientInfo::ComputeChannelBufferSize(int32_t pid)
+{
+    int64_t eventCount = 0;
+    {
+        std::lock_guard<std::mutex> clientLock(clientMutex_);
+        for (const auto &sensorIt : clientMap_) {
+            auto pidIt = sensorIt.second.find(pid);
+            if ((pidIt == sensorIt.second.end()) || (!pidIt->second.GetSensorState())) {
+                continue;
+            }
+            int64_t samplingPeriodNs = pidIt->second.GetSamplingPeriodNs();
+            int64_t windowNs = std::max(CHANNEL_STALL_TOLERANCE_NS, pidIt->second.GetMaxReportDelayNs());
+            eventCount += (samplingPeriodNs <= 0L) ? 1 : (windowNs / samplingPeriodNs + 1);
+        }
+    }
+    int64_t bufferSize = eventCount * static_cast<int64_t>(sizeof(SensorData));
+    return static_cast<int32_t>(std::min(bufferSize, static_cast<int64_t>(INT32_MAX)));
+}
+
 int32_t ClientInfo::GetStoreEvent(const SensorDescription &sensorDesc, SensorData &data)
 {
     std::lock_guard<std::mutex> lock(eventMutex_);
@@ -624,6 +699,14 @@ void ClientInfo::GetSensorChannelInfo(std::vector<SensorChannelInfo> &channelInf
             channel.SetSamplingPeriodNs(samplingPeriodNs);
             uint32_t fifoCount = (samplingPeriodNs == 0) ? 0 : (uint32_t)(maxReportDelayNs / samplingPeriodNs);
             channel.SetFifoCount(fifoCount);
+            {
+                std::lock_guard<std::mutex> channelLock(channelMutex_);
+                auto channelIt = channelMap_.find(pid);
+                if ((channelIt != channelMap_.end()) && (channelIt->second != nullptr)) {
+                    channel.SetBufferSize(channelIt->second->GetSendBufferSize());
+                    channel.SetLostEventCount(channelIt->second->GetLostEventCount());
+                }
+            }
             channel.SetCmdType(GetCmdList(sensorIt.first.sensorType, uid));
             channelInfo.push_back(channel);
         }
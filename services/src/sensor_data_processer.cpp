@@ -15,6 +15,8 @@
 
 #include "sensor_data_processer.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cinttypes>
 #include <sys/prctl.h>
 #include <sys/socket.h>
@@ -38,25 +40,74 @@ const std::set<int32_t> g_noNeedMotionTransform = {
     SENSOR_TYPE_ID_POSTURE, SENSOR_TYPE_ID_HALL, SENSOR_TYPE_ID_HALL_EXT,
     SENSOR_TYPE_ID_PROXIMITY, SENSOR_TYPE_ID_PROXIMITY1, SENSOR_TYPE_ID_AMBIENT_LIGHT
 };
+
+int64_t GetSteadyTimeNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 } // namespace
 
 SensorDataProcesser::SensorDataProcesser(const std::unordered_map<SensorDescription, Sensor> &sensorMap)
 {
-    sensorMap_.insert(sensorMap.begin(), sensorMap.end());
-    SEN_HILOGD("sensorMap_.size:%{public}d", int32_t { sensorMap_.size() });
+    PublishSensorMap(std::make_shared<const std::unordered_map<SensorDescription, Sensor>>(sensorMap));
+    SEN_HILOGD("sensorMap_.size:%{public}zu", sensorMap.size());
 }
 
 SensorDataProcesser::~SensorDataProcesser()
 {
     dataCountMap_.clear();
-    sensorMap_.clear();
+    sensorMap_.reset();
+}
+
+std::shared_ptr<const std::unordered_map<SensorDescription, Sensor>> SensorDataProcesser::GetSensorMap() const
+{
+    return std::atomic_load(&sensorMap_);
+}
+
+void SensorDataProcesser::PublishSensorMap(
+    std::shared_ptr<const std::unordered_map<SensorDescription, Sensor>> sensorMap)
+{
+    std::atomic_store(&sensorMap_, std::move(sensorMap));
 }
 
 void SensorDataProcesser::UpdateSensorMap(const std::unordered_map<SensorDescription, Sensor> &sensorMap)
 {
-    sensorMap_.clear();
-    sensorMap_.insert(sensorMap.begin(), sensorMap.end());
-    SEN_HILOGD("sensorMap_.size:%{public}d", int32_t { sensorMap_.size() });
+    std::lock_guard<std::mutex> sensorLock(sensorMutex_);
+    PublishSensorMap(std::make_shared<const std::unordered_map<SensorDescription, Sensor>>(sensorMap));
+    SEN_HILOGD("sensorMap_.size:%{public}zu", sensorMap.size());
+}
+
+void SensorDataProcesser::AddSensors(const std::vector<Sensor> &sensors)
+{
+    if (sensors.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> sensorLock(sensorMutex_);
+    auto current = GetSensorMap();
+    auto sensorMap = (current == nullptr) ? std::make_shared<std::unordered_map<SensorDescription, Sensor>>() :
+        std::make_shared<std::unordered_map<SensorDescription, Sensor>>(*current);
+    for (const auto &sensor : sensors) {
+        SensorDescription sensorDesc = {
+            sensor.GetDeviceId(), sensor.GetSensorTypeId(), sensor.GetSensorId(), sensor.GetLocation()
+        };
+        (*sensorMap)[sensorDesc] = sensor;
+    }
+    SEN_HILOGD("sensorMap_.size:%{public}zu", sensorMap->size());
+    PublishSensorMap(std::move(sensorMap));
+}
+
+void SensorDataProcesser::RemoveSensor(const SensorDescription &sensorDesc)
+{
+    std::lock_guard<std::mutex> sensorLock(sensorMutex_);
+    auto current = GetSensorMap();
+    if (current == nullptr || current->find(sensorDesc) == current->end()) {
+        return;
+    }
+    auto sensorMap = std::make_shared<std::unordered_map<SensorDescription, Sensor>>(*current);
+    sensorMap->erase(sensorDesc);
+    SEN_HILOGD("sensorMap_.size:%{public}zu", sensorMap->size());
+    PublishSensorMap(std::move(sensorMap));
 }
 
 void SensorDataProcesser::SendNoneFifoCacheData(std::unordered_map<SensorDescription, SensorData> &cacheBuf,
@@ -205,26 +256,100 @@ bool SensorDataProcesser::ReportNotContinuousData(std::unordered_map<SensorDescr
                                                   sptr<SensorBasicDataChannel> &channel, SensorData &data)
 {
     int32_t sensorTypeId = data.sensorTypeId;
-    std::lock_guard<std::mutex> sensorLock(sensorMutex_);
-    auto sensor = sensorMap_.find({data.deviceId, data.sensorTypeId, data.sensorId, data.location});
-    if (sensor == sensorMap_.end()) {
+    auto sensorMap = GetSensorMap();
+    CHKPF(sensorMap);
+    if (sensorMap->find({data.deviceId, data.sensorTypeId, data.sensorId, data.location}) == sensorMap->end()) {
         SEN_HILOGE("Data's SensorDesc is not supported");
         return false;
     }
-    sensor->second.SetFlags(data.mode);
-    if (((SENSOR_ON_CHANGE & sensor->second.GetFlags()) == SENSOR_ON_CHANGE) ||
-        ((SENSOR_ONE_SHOT & sensor->second.GetFlags()) == SENSOR_ONE_SHOT)) {
-        std::vector<SensorData> sendEvents;
-        sendEvents.push_back(data);
+    uint32_t flags = static_cast<uint32_t>(data.mode);
+    if (((SENSOR_ON_CHANGE & flags) == SENSOR_ON_CHANGE) || ((SENSOR_ONE_SHOT & flags) == SENSOR_ONE_SHOT)) {
         if (sensorTypeId == SENSOR_TYPE_ID_HALL_EXT) {
             PrintSensorData::GetInstance().PrintSensorDataLog("ReportNotContinuousData", data);
         }
+        if ((SENSOR_ONE_SHOT & flags) != SENSOR_ONE_SHOT) {
+            SensorDescription sensorDesc = {data.deviceId, data.sensorTypeId, data.sensorId, data.location};
+            int64_t window = clientInfo_.ComputeCoalesceWindow(sensorDesc, channel);
+            if (window > 0L) {
+                CoalesceData(cacheBuf, channel, data, window);
+                return true;
+            }
+            auto &coalesceBuf = channel->GetCoalesceBuf();
+            if (!coalesceBuf.empty()) {
+                coalesceBuf.erase(sensorDesc);
+            }
+        }
+        std::vector<SensorData> sendEvents;
+        sendEvents.push_back(data);
         SendRawData(cacheBuf, channel, sendEvents);
         return true;
     }
     return false;
 }
 
+void SensorDataProcesser::CoalesceData(std::unordered_map<SensorDescription, SensorData> &cacheBuf,
+                                       sptr<SensorBasicDataChannel> &channel, const SensorData &data, int64_t window)
+{
+    int64_t now = GetSteadyTimeNs();
+    CoalescedEvent &slot = channel->GetCoalesceBuf()[{data.deviceId, data.sensorTypeId, data.sensorId,
+        data.location}];
+    slot.window = window;
+    // The first change after a quiet window is sent at once, later ones only keep the latest value
+    if (!slot.pending && now >= slot.windowEnd) {
+        slot.windowEnd = now + window;
+        std::vector<SensorData> sendEvents;
+        sendEvents.push_back(data);
+        SendRawData(cacheBuf, channel, sendEvents);
+        return;
+    }
+    if (std::find(coalescedChannels_.begin(), coalescedChannels_.end(), channel) == coalescedChannels_.end()) {
+        coalescedChannels_.push_back(channel);
+    }
+    slot.data = data;
+    slot.pending = true;
+    if (nextFlushTime_ == 0 || slot.windowEnd < nextFlushTime_) {
+        nextFlushTime_ = slot.windowEnd;
+    }
+}
+
+void SensorDataProcesser::FlushCoalescedData()
+{
+    if (coalescedChannels_.empty()) {
+        nextFlushTime_ = 0;
+        return;
+    }
+    int64_t now = GetSteadyTimeNs();
+    nextFlushTime_ = 0;
+    for (auto channelIt = coalescedChannels_.begin(); channelIt != coalescedChannels_.end();) {
+        sptr<SensorBasicDataChannel> channel = *channelIt;
+        if (channel->IsDead()) {
+            channelIt = coalescedChannels_.erase(channelIt);
+            continue;
+        }
+        auto &cacheBuf = const_cast<std::unordered_map<SensorDescription, SensorData> &>(channel->GetDataCacheBuf());
+        bool hasPending = false;
+        for (auto &slotIt : channel->GetCoalesceBuf()) {
+            CoalescedEvent &slot = slotIt.second;
+            if (!slot.pending) {
+                continue;
+            }
+            if (slot.windowEnd > now) {
+                hasPending = true;
+                nextFlushTime_ = (nextFlushTime_ == 0) ? slot.windowEnd : std::min(nextFlushTime_, slot.windowEnd);
+                continue;
+            }
+            slot.pending = false;
+            slot.windowEnd = now + slot.window;
+            if (channel->GetSensorStatus()) {
+                std::vector<SensorData> sendEvents;
+                sendEvents.push_back(slot.data);
+                SendRawData(cacheBuf, channel, sendEvents);
+            }
+        }
+        channelIt = hasPending ? channelIt + 1 : coalescedChannels_.erase(channelIt);
+    }
+}
+
 void SensorDataProcesser::SendRawData(std::unordered_map<SensorDescription, SensorData> &cacheBuf,
                                       sptr<SensorBasicDataChannel> channel, std::vector<SensorData> events)
 {
@@ -237,8 +362,11 @@ void SensorDataProcesser::SendRawData(std::unordered_map<SensorDescription, Sens
     if (ret != ERR_OK) {
         SEN_HILOGE("Send data failed, ret:%{public}d, sensorTypeId:%{public}d, timestamp:%{public}" PRId64,
             ret, events[eventSize - 1].sensorTypeId, events[eventSize - 1].timestamp);
-        cacheBuf[{events[eventSize - 1].deviceId, events[eventSize - 1].sensorTypeId,
-            events[eventSize - 1].sensorId, events[eventSize - 1].location}] = events[eventSize - 1];
+        SensorDescription sensorDesc = { events[eventSize - 1].deviceId, events[eventSize - 1].sensorTypeId,
+            events[eventSize - 1].sensorId, events[eventSize - 1].location };
+        // Only the newest event is kept for a retry, and it replaces any event cached before it
+        channel->AddLostEventCount(eventSize - 1 + cacheBuf.count(sensorDesc));
+        cacheBuf[sensorDesc] = events[eventSize - 1];
     }
 }
 
@@ -250,20 +378,26 @@ int32_t SensorDataProcesser::CacheSensorEvent(const SensorData &data, sptr<Senso
     if (data.sensorTypeId == SENSOR_TYPE_ID_HALL_EXT) {
         PrintSensorData::GetInstance().PrintSensorDataLog("CacheSensorEvent", data);
     }
-    auto cacheEvent = cacheBuf.find({data.deviceId, data.sensorTypeId, data.sensorId, data.location});
+    SensorDescription sensorDesc = {data.deviceId, data.sensorTypeId, data.sensorId, data.location};
+    auto cacheEvent = cacheBuf.find(sensorDesc);
     if (cacheEvent != cacheBuf.end()) {
-        // Try to send the last failed value, if it still fails, replace the previous cache directly
+        // Try to send the last failed value, if it still fails, replace the previous cache directly.
+        // Coalesced subscriptions only want the latest value, so the stale one is dropped instead.
         const SensorData &cacheData = cacheEvent->second;
-        ret = channel->SendData(&cacheData, sizeof(SensorData));
-        if (ret != ERR_OK) {
-            SEN_HILOGE("retry send cacheData failed, ret:%{public}d, sensorType:%{public}d, timestamp:%{public}" PRId64,
-                ret, cacheData.sensorTypeId, cacheData.timestamp);
+        auto &coalesceBuf = channel->GetCoalesceBuf();
+        if (coalesceBuf.find(sensorDesc) == coalesceBuf.end()) {
+            ret = channel->SendData(&cacheData, sizeof(SensorData));
+            if (ret != ERR_OK) {
+                SEN_HILOGE("retry send cacheData failed, ret:%{public}d, sensorType:%{public}d, "
+                    "timestamp:%{public}" PRId64, ret, cacheData.sensorTypeId, cacheData.timestamp);
+                channel->AddLostEventCount(1);
+            }
         }
         ret = channel->SendData(&data, sizeof(SensorData));
         if (ret != ERR_OK) {
             SEN_HILOGE("retry send data failed, ret:%{public}d, sensorType:%{public}d, timestamp:%{public}" PRId64,
                 ret, data.sensorTypeId, data.timestamp);
-            cacheBuf[{data.deviceId, data.sensorTypeId, data.sensorId, data.location}] = data;
+            cacheBuf[sensorDesc] = data;
         } else {
             cacheBuf.erase(cacheEvent);
         }
@@ -291,6 +425,9 @@ void SensorDataProcesser::EventFilter(CircularEventBuf &eventsBuf)
             SEN_HILOGE("channel is null");
             continue;
         }
+        if (channel->IsDead()) {
+            continue;
+        }
         if (!channel->GetSensorStatus()) {
             SEN_HILOGW("Sensor status is not active");
             continue;
@@ -309,7 +446,17 @@ int32_t SensorDataProcesser::ProcessEvents(sptr<ReportDataCallback> dataCallback
 {
     CHKPR(dataCallback, INVALID_POINTER);
     std::unique_lock<std::mutex> lk(ISensorHdiConnection::dataMutex_);
-    ISensorHdiConnection::dataCondition_.wait(lk, [this] { return ISensorHdiConnection::dataReady_.load(); });
+    if (nextFlushTime_ == 0) {
+        ISensorHdiConnection::dataCondition_.wait(lk, [this] { return ISensorHdiConnection::dataReady_.load(); });
+    } else {
+        std::chrono::steady_clock::time_point deadline { std::chrono::nanoseconds(nextFlushTime_) };
+        ISensorHdiConnection::dataCondition_.wait_until(lk, deadline,
+            [this] { return ISensorHdiConnection::dataReady_.load(); });
+        FlushCoalescedData();
+        if (!ISensorHdiConnection::dataReady_.load()) {
+            return SUCCESS;
+        }
+    }
     ISensorHdiConnection::dataReady_.store(false);
     auto &eventsBuf = dataCallback->GetEventData();
     if (eventsBuf.eventNum <= 0) {
@@ -96,11 +96,13 @@ void SensorDump::RunSensorDump(int32_t fd, int32_t optionIndex, const std::vecto
         {"open", no_argument, 0, 'o'},
         {"help", no_argument, 0, 'h'},
         {"list", no_argument, 0, 'l'},
+        {"session", no_argument, 0, 's'},
+        {"time", no_argument, 0, 't'},
         {NULL, 0, 0, 0}
     };
     optind = 1;
     int32_t c;
-    while ((c = getopt_long(args.size(), argv, "cdohl", dumpOptions, &optionIndex)) != -1) {
+    while ((c = getopt_long(args.size(), argv, "cdohlst", dumpOptions, &optionIndex)) != -1) {
         switch (c) {
             case 'c': {
                 DumpSensorChannel(fd, clientInfo_);
@@ -124,6 +126,14 @@ void SensorDump::RunSensorDump(int32_t fd, int32_t optionIndex, const std::vecto
                 DumpSensorList(fd, sensors_);
                 break;
             }
+            case 's': {
+                DumpSession(fd, sessionInfo_);
+                break;
+            }
+            case 't': {
+                DumpStartupTime(fd);
+                break;
+            }
             default: {
                 dprintf(fd, "Unrecognized option, More info with: \"hidumper -s 3601 -a -h\"\n");
                 break;
@@ -133,7 +143,7 @@ void SensorDump::RunSensorDump(int32_t fd, int32_t optionIndex, const std::vecto
 }
 
 void SensorDump::ParseCommand(int32_t fd, const std::vector<std::string> &args, const std::vector<Sensor> &sensors,
-    ClientInfo &clientInfo)
+    const std::vector<SessionInfo> &sessionInfo, ClientInfo &clientInfo)
 {
     int32_t count = 0;
     for (const auto &str : args) {
@@ -171,6 +181,7 @@ void SensorDump::ParseCommand(int32_t fd, const std::vector<std::string> &args,
         }
     }
     sensors_ = sensors;
+    sessionInfo_ = sessionInfo;
     RunSensorDump(fd, optionIndex, args, argv);
     RELEASE_RES:
     for (size_t i = 0; i < args.size(); ++i) {
@@ -188,6 +199,8 @@ void SensorDump::DumpHelp(int32_t fd)
     dprintf(fd, "      -l, --list: dump the sensor list\n");
     dprintf(fd, "      -c, --channel: dump the sensor data channel info\n");
     dprintf(fd, "      -o, --open: dump the opening sensors\n");
+    dprintf(fd, "      -s, --session: dump the client sessions and their memory usage\n");
+    dprintf(fd, "      -t, --time: dump the duration of each service startup phase\n");
 #ifdef BUILD_VARIANT_ENG 
     dprintf(fd, "      -d, --data: dump the last 10 packages sensor data\n");
 #endif // BUILD_VARIANT_ENG
@@ -230,9 +243,10 @@ bool SensorDump::DumpSensorChannel(int32_t fd, ClientInfo &clientInfo)
         }
         dprintf(fd,
                 "uid:%d | packageName:%s | deviceIndex:%d | sensorType:%s |sensorId:%8u |sensorIndex:%d "
-                "| samplingPeriodNs:%" PRId64 "| fifoCount:%u\n",
+                "| samplingPeriodNs:%" PRId64 "| fifoCount:%u | bufferSize:%d | lostEvents:%" PRIu64 "\n",
                 channel.GetUid(), channel.GetPackageName().c_str(), deviceId, sensorMap_[sensorType].c_str(),
-                sensorType, sensorId, channel.GetSamplingPeriodNs(), channel.GetFifoCount());
+                sensorType, sensorId, channel.GetSamplingPeriodNs(), channel.GetFifoCount(), channel.GetBufferSize(),
+                channel.GetLostEventCount());
     }
     return true;
 }
@@ -286,6 +300,45 @@ bool SensorDump::DumpSensorData(int32_t fd, ClientInfo &clientInfo)
 }
 #endif // BUILD_VARIANT_ENG
 
+bool SensorDump::DumpStartupTime(int32_t fd)
+{
+    DumpCurrentTime(fd);
+    std::lock_guard<std::mutex> startupLock(startupMutex_);
+    dprintf(fd, "Startup phases:%zu\n", startupPhases_.size());
+    for (const auto &phase : startupPhases_) {
+        dprintf(fd, "%-16s: %" PRId64 "ms\n", phase.first.c_str(), phase.second);
+    }
+    return true;
+}
+
+bool SensorDump::DumpSession(int32_t fd, const std::vector<SessionInfo> &sessionInfo)
+{
+    DumpCurrentTime(fd);
+    size_t totalSize = 0;
+    for (const auto &info : sessionInfo) {
+        totalSize += info.memorySize;
+    }
+    dprintf(fd, "Total session:%zu, memory:%zu bytes, Session list:\n", sessionInfo.size(), totalSize);
+    for (const auto &info : sessionInfo) {
+        dprintf(fd, "fd:%d | pid:%d | uid:%d | programName:%s | memory:%zu | outputQueue:%zu\n",
+            info.fd, info.pid, info.uid, info.programName.c_str(), info.memorySize, info.outputSize);
+    }
+    return true;
+}
+
+void SensorDump::RecordStartupPhase(const std::string &phase, int64_t durationMs)
+{
+    SEN_HILOGI("Startup phase:%{public}s, duration:%{public}" PRId64 "ms", phase.c_str(), durationMs);
+    std::lock_guard<std::mutex> startupLock(startupMutex_);
+    startupPhases_.emplace_back(phase, durationMs);
+}
+
+void SensorDump::ClearStartupPhases()
+{
+    std::lock_guard<std::mutex> startupLock(startupMutex_);
+    startupPhases_.clear();
+}
+
 void SensorDump::DumpCurrentTime(int32_t fd)
 {
     timespec curTime = { 0, 0 };
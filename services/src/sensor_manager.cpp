@@ -16,6 +16,11 @@
 #include "sensor_manager.h"
 
 #include <cinttypes>
+#include <climits>
+
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+#include "parameters.h"
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
 
 #undef LOG_TAG
 #define LOG_TAG "SensorManager"
@@ -26,6 +31,8 @@ using namespace OHOS::HiviewDFX;
 namespace {
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
 constexpr int32_t INVALID_SENSOR_ID = -1;
+constexpr int32_t DEFAULT_RECONFIG_WINDOW_MS = 20;
+constexpr int32_t MAX_RECONFIG_WINDOW_MS = 1000;
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
 constexpr uint32_t PROXIMITY_SENSOR_ID = 50331904;
 constexpr float PROXIMITY_FAR = 5.0;
@@ -39,6 +46,8 @@ void SensorManager::InitSensorMap(const std::unordered_map<SensorDescription, Se
     sensorMap_.insert(sensorMap.begin(), sensorMap.end());
     sensorDataProcesser_ = dataProcesser;
     reportDataCallback_ = dataCallback;
+    reconfigWindow_ = std::chrono::milliseconds(OHOS::system::GetIntParameter<int32_t>(
+        "persist.sensor.reconfig_window_ms", DEFAULT_RECONFIG_WINDOW_MS, 0, MAX_RECONFIG_WINDOW_MS));
     SEN_HILOGD("Begin sensorMap_.size:%{public}zu", sensorMap_.size());
 }
 
@@ -60,9 +69,8 @@ bool SensorManager::SetBestSensorParams(const SensorDescription &sensorDesc, int
     bestSamplingPeriodNs = (samplingPeriodNs < bestSamplingPeriodNs) ? samplingPeriodNs : bestSamplingPeriodNs;
     bestReportDelayNs = (maxReportDelayNs < bestReportDelayNs) ? maxReportDelayNs : bestReportDelayNs;
     SEN_HILOGD("bestSamplingPeriodNs : %{public}" PRId64, bestSamplingPeriodNs);
-    auto ret = sensorHdiConnection_.SetBatch(sensorDesc, bestSamplingPeriodNs, bestReportDelayNs);
-    if (ret != ERR_OK) {
-        SEN_HILOGE("SetBatch is failed");
+    if (!ApplySensorParams(sensorDesc, bestSamplingPeriodNs, bestReportDelayNs)) {
+        SEN_HILOGE("ApplySensorParams is failed");
         return false;
     }
     SEN_HILOGI("Done, sensorType:%{public}d", sensorDesc.sensorType);
@@ -78,16 +86,145 @@ bool SensorManager::ResetBestSensorParams(const SensorDescription &sensorDesc)
         return false;
     }
     SensorBasicInfo sensorInfo = clientInfo_.GetBestSensorInfo(sensorDesc);
-    auto ret = sensorHdiConnection_.SetBatch(sensorDesc,
-        sensorInfo.GetSamplingPeriodNs(), sensorInfo.GetMaxReportDelayNs());
+    if (!ApplySensorParams(sensorDesc, sensorInfo.GetSamplingPeriodNs(), sensorInfo.GetMaxReportDelayNs())) {
+        SEN_HILOGE("ApplySensorParams is failed");
+        return false;
+    }
+    SEN_HILOGI("Done, sensorType:%{public}d", sensorDesc.sensorType);
+    return true;
+}
+
+bool SensorManager::ApplySensorParams(const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
+    int64_t maxReportDelayNs)
+{
+    std::lock_guard<std::mutex> batchLock(batchMutex_);
+    auto it = appliedParams_.find(sensorDesc);
+    if ((it != appliedParams_.end()) && (samplingPeriodNs >= it->second.samplingPeriodNs) &&
+        (maxReportDelayNs >= it->second.maxReportDelayNs)) {
+        if ((samplingPeriodNs == it->second.samplingPeriodNs) && (maxReportDelayNs == it->second.maxReportDelayNs)) {
+            SEN_HILOGD("Sensor params unchanged, sensorType:%{public}d", sensorDesc.sensorType);
+            pendingReconfig_.erase(sensorDesc);
+            return true;
+        }
+        if (reconfigWindow_.count() > 0) {
+            ScheduleReconfig(sensorDesc);
+            return true;
+        }
+    }
+    pendingReconfig_.erase(sensorDesc);
+    auto ret = sensorHdiConnection_.SetBatch(sensorDesc, samplingPeriodNs, maxReportDelayNs);
     if (ret != ERR_OK) {
         SEN_HILOGE("SetBatch is failed");
         return false;
     }
-    SEN_HILOGI("Done, sensorType:%{public}d", sensorDesc.sensorType);
+    BatchParams &params = appliedParams_[sensorDesc];
+    params.samplingPeriodNs = samplingPeriodNs;
+    params.maxReportDelayNs = maxReportDelayNs;
+    ++params.batchCount;
     return true;
 }
 
+uint32_t SensorManager::GetBatchCount(const SensorDescription &sensorDesc)
+{
+    std::lock_guard<std::mutex> batchLock(batchMutex_);
+    auto it = appliedParams_.find(sensorDesc);
+    return (it == appliedParams_.end()) ? 0 : it->second.batchCount;
+}
+
+void SensorManager::ScheduleReconfig(const SensorDescription &sensorDesc)
+{
+    if (pendingReconfig_.find(sensorDesc) != pendingReconfig_.end()) {
+        SEN_HILOGD("Reconfig already pending, sensorType:%{public}d", sensorDesc.sensorType);
+        return;
+    }
+    if (reconfigStop_) {
+        SEN_HILOGW("Reconfig thread is stopped, sensorType:%{public}d", sensorDesc.sensorType);
+        return;
+    }
+    pendingReconfig_.emplace(sensorDesc, std::chrono::steady_clock::now() + reconfigWindow_);
+    if (!reconfigThread_.joinable()) {
+        reconfigThread_ = std::thread(&SensorManager::ReconfigThread, this);
+    }
+    reconfigCondition_.notify_one();
+}
+
+void SensorManager::StopReconfigThread()
+{
+    {
+        std::lock_guard<std::mutex> batchLock(batchMutex_);
+        reconfigStop_ = true;
+        pendingReconfig_.clear();
+        forcedReconfig_.clear();
+    }
+    reconfigCondition_.notify_one();
+    if (reconfigThread_.joinable()) {
+        reconfigThread_.join();
+    }
+}
+
+void SensorManager::ReconfigThread()
+{
+    std::unique_lock<std::mutex> batchLock(batchMutex_);
+    while (!reconfigStop_) {
+        if (pendingReconfig_.empty()) {
+            reconfigCondition_.wait(batchLock, [this] { return reconfigStop_ || !pendingReconfig_.empty(); });
+            continue;
+        }
+        auto next = pendingReconfig_.begin();
+        for (auto iter = pendingReconfig_.begin(); iter != pendingReconfig_.end(); ++iter) {
+            if (iter->second < next->second) {
+                next = iter;
+            }
+        }
+        if (std::chrono::steady_clock::now() < next->second) {
+            reconfigCondition_.wait_until(batchLock, next->second);
+            continue;
+        }
+        SensorDescription sensorDesc = next->first;
+        pendingReconfig_.erase(next);
+        bool isForced = (forcedReconfig_.erase(sensorDesc) > 0);
+        auto it = appliedParams_.find(sensorDesc);
+        if (it == appliedParams_.end()) {
+            continue;
+        }
+        BatchParams snapshot = it->second;
+        // Neither the client lookup nor the HDI call may block binder threads waiting on batchMutex_
+        batchLock.unlock();
+        SensorBasicInfo sensorInfo = clientInfo_.GetBestSensorInfo(sensorDesc);
+        int64_t samplingPeriodNs = sensorInfo.GetSamplingPeriodNs();
+        int64_t maxReportDelayNs = sensorInfo.GetMaxReportDelayNs();
+        bool isChanged = (samplingPeriodNs != LLONG_MAX) && (isForced ||
+            (samplingPeriodNs != snapshot.samplingPeriodNs) || (maxReportDelayNs != snapshot.maxReportDelayNs));
+        int32_t ret = ERR_OK;
+        if (isChanged) {
+            ret = sensorHdiConnection_.SetBatch(sensorDesc, samplingPeriodNs, maxReportDelayNs);
+        }
+        batchLock.lock();
+        it = appliedParams_.find(sensorDesc);
+        if (!isChanged || (it == appliedParams_.end())) {
+            continue;
+        }
+        if ((it->second.samplingPeriodNs != snapshot.samplingPeriodNs) ||
+            (it->second.maxReportDelayNs != snapshot.maxReportDelayNs) ||
+            (it->second.batchCount != snapshot.batchCount)) {
+            // A synchronous SetBatch ran meanwhile and either call may have reached the HDI last, settle it again
+            SEN_HILOGW("Sensor params changed during reconfig, sensorType:%{public}d", sensorDesc.sensorType);
+            pendingReconfig_[sensorDesc] = std::chrono::steady_clock::now();
+            forcedReconfig_.insert(sensorDesc);
+            continue;
+        }
+        if (ret != ERR_OK) {
+            SEN_HILOGE("Deferred SetBatch is failed, sensorType:%{public}d", sensorDesc.sensorType);
+            continue;
+        }
+        it->second.samplingPeriodNs = samplingPeriodNs;
+        it->second.maxReportDelayNs = maxReportDelayNs;
+        ++it->second.batchCount;
+        SEN_HILOGI("Deferred SetBatch done, sensorType:%{public}d, samplingPeriodNs:%{public}" PRId64,
+            sensorDesc.sensorType, samplingPeriodNs);
+    }
+}
+
 void SensorManager::StartDataReportThread()
 {
     CALL_LOG_ENTER;
@@ -172,6 +309,14 @@ ErrCode SensorManager::AfterDisableSensor(const SensorDescription &sensorDesc)
 {
     SEN_HILOGI("In, sensorType:%{public}d", sensorDesc.sensorType);
     clientInfo_.ClearSensorInfo(sensorDesc);
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    {
+        std::lock_guard<std::mutex> batchLock(batchMutex_);
+        appliedParams_.erase(sensorDesc);
+        pendingReconfig_.erase(sensorDesc);
+        forcedReconfig_.erase(sensorDesc);
+    }
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
     if (sensorDesc.sensorType == PROXIMITY_SENSOR_ID) {
         SensorData sensorData;
         auto ret = clientInfo_.GetStoreEvent(sensorDesc, sensorData);
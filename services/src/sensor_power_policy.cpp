@@ -15,6 +15,11 @@
 
 #include "sensor_power_policy.h"
 
+#include <algorithm>
+#include <sys/prctl.h>
+#include <thread>
+
+#include "message_schema.h"
 #ifdef OHOS_BUILD_ENABLE_RUST
 #include "rust_binding.h"
 #endif // OHOS_BUILD_ENABLE_RUST
@@ -28,6 +33,8 @@ using namespace OHOS::HiviewDFX;
 namespace {
 constexpr int32_t INVALID_SENSOR_ID = -1;
 constexpr int64_t MAX_EVENT_COUNT = 1000;
+constexpr size_t MAX_ACTIVE_INFO_QUEUE_SIZE = 64;
+const std::string ACTIVE_INFO_THREAD_NAME = "OS_SenActiveInfo";
 ClientInfo &clientInfo_ = ClientInfo::GetInstance();
 SensorManager &sensorManager_ = SensorManager::GetInstance();
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
@@ -43,50 +50,56 @@ bool SensorPowerPolicy::CheckFreezingSensor(int32_t sensorType)
 ErrCode SensorPowerPolicy::SuspendSensors(int32_t pid)
 {
     CALL_LOG_ENTER;
-    std::vector<SensorDescription> sensorDescList = clientInfo_.GetSensorIdByPid(pid);
-    if (sensorDescList.empty()) {
-        SEN_HILOGD("Suspend sensors failed, sensorIdList is empty, pid:%{public}d", pid);
+    std::vector<SensorDescription> disableList;
+    std::vector<SensorDescription> resetList;
+    std::lock_guard<std::mutex> pidSensorInfoLock(pidSensorInfoMutex_);
+    if (!SuspendPidLocked(pid, disableList, resetList)) {
         return SUSPEND_ERR;
     }
-    std::lock_guard<std::mutex> pidSensorInfoLock(pidSensorInfoMutex_);
-    auto pidSensorInfoIt = pidSensorInfoMap_.find(pid);
-    if (pidSensorInfoIt != pidSensorInfoMap_.end()) {
-        std::unordered_map<SensorDescription, SensorBasicInfo> sensorInfoMap = pidSensorInfoIt->second;
-        if (!Suspend(pid, sensorDescList, sensorInfoMap)) {
-            SEN_HILOGE("Suspend part sensors, but some failed, pid:%{public}d", pid);
-            return SUSPEND_ERR;
-        }
-        SEN_HILOGI("Suspend sensors success, pid:%{public}d", pid);
-        return ERR_OK;
-    }
-    std::unordered_map<SensorDescription, SensorBasicInfo> sensorInfoMap;
-    auto isAllSuspend = Suspend(pid, sensorDescList, sensorInfoMap);
-    pidSensorInfoMap_.insert(std::make_pair(pid, sensorInfoMap));
-    if (!isAllSuspend) {
-        SEN_HILOGE("Suspend all sensors, but some failed, pid:%{public}d", pid);
+    if (!ApplySuspendLocked(disableList, resetList)) {
+        SEN_HILOGE("Suspend sensors, but some failed, pid:%{public}d", pid);
         return SUSPEND_ERR;
     }
     SEN_HILOGI("Suspend sensors success, pid:%{public}d", pid);
     return ERR_OK;
 }
 
-bool SensorPowerPolicy::Suspend(int32_t pid, const std::vector<SensorDescription> &sensorDescList,
-    std::unordered_map<SensorDescription, SensorBasicInfo> &sensorInfoMap)
+bool SensorPowerPolicy::SuspendPidLocked(int32_t pid, std::vector<SensorDescription> &disableList,
+    std::vector<SensorDescription> &resetList)
 {
-    CALL_LOG_ENTER;
-    bool isAllSuspend = true;
+    std::vector<SensorDescription> sensorDescList = clientInfo_.GetSensorIdByPid(pid);
+    if (sensorDescList.empty()) {
+        SEN_HILOGD("Suspend sensors failed, sensorIdList is empty, pid:%{public}d", pid);
+        return false;
+    }
+    auto &sensorInfoMap = pidSensorInfoMap_[pid];
     for (const auto &sensorDesc : sensorDescList) {
         if (CheckFreezingSensor(sensorDesc.sensorType)) {
             SEN_HILOGD("Current sensor is pedometer detection or pedometer, can not suspend");
             continue;
         }
-        auto sensorInfo = clientInfo_.GetCurPidSensorInfo(sensorDesc, pid);
-        if (sensorManager_.IsOtherClientUsingSensor(sensorDesc, pid)) {
-            SEN_HILOGD("Other client is using this sensor now, cannot suspend, sensorType:%{public}d",
-                sensorDesc.sensorType);
-            sensorInfoMap.insert(std::make_pair(sensorDesc, sensorInfo));
+        sensorInfoMap.insert(std::make_pair(sensorDesc, clientInfo_.GetCurPidSensorInfo(sensorDesc, pid)));
+        if (clientInfo_.OnlyCurPidSensorEnabled(sensorDesc, pid)) {
+            if (std::find(disableList.begin(), disableList.end(), sensorDesc) == disableList.end()) {
+                disableList.push_back(sensorDesc);
+            }
             continue;
         }
+        // Other clients keep the sensor running, only its params are recomputed without this pid
+        clientInfo_.ClearCurPidSensorInfo(sensorDesc, pid);
+        if (std::find(resetList.begin(), resetList.end(), sensorDesc) == resetList.end()) {
+            resetList.push_back(sensorDesc);
+        }
+    }
+    return true;
+}
+
+bool SensorPowerPolicy::ApplySuspendLocked(const std::vector<SensorDescription> &disableList,
+    std::vector<SensorDescription> &resetList)
+{
+    bool isAllSuspend = true;
+    for (const auto &sensorDesc : disableList) {
+        resetList.erase(std::remove(resetList.begin(), resetList.end(), sensorDesc), resetList.end());
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
         auto ret = sensorHdiConnection_.DisableSensor(sensorDesc);
         if (ret != ERR_OK) {
@@ -94,9 +107,15 @@ bool SensorPowerPolicy::Suspend(int32_t pid, const std::vector<SensorDescription
             SEN_HILOGE("Hdi disable sensor failed, sensorType:%{public}d, ret:%{public}d", sensorDesc.sensorType, ret);
         }
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
-        sensorInfoMap.insert(std::make_pair(sensorDesc, sensorInfo));
         sensorManager_.AfterDisableSensor(sensorDesc);
     }
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    for (const auto &sensorDesc : resetList) {
+        if (!sensorManager_.ResetBestSensorParams(sensorDesc)) {
+            SEN_HILOGW("ResetBestSensorParams is failed, sensorType:%{public}d", sensorDesc.sensorType);
+        }
+    }
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
     return isAllSuspend;
 }
 
@@ -131,15 +150,129 @@ ErrCode SensorPowerPolicy::ResumeSensors(int32_t pid)
     return ERR_OK;
 }
 
-bool SensorPowerPolicy::Resume(int32_t pid, const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
-    int64_t maxReportDelayNs)
+ErrCode SensorPowerPolicy::SuspendSensors(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    bool isAllSuspend = true;
+    std::vector<SensorDescription> disableList;
+    std::vector<SensorDescription> resetList;
+    std::lock_guard<std::mutex> pidSensorInfoLock(pidSensorInfoMutex_);
+    for (const auto &pid : pids) {
+        if (!SuspendPidLocked(pid, disableList, resetList)) {
+            isAllSuspend = false;
+        }
+    }
+    if (!ApplySuspendLocked(disableList, resetList)) {
+        isAllSuspend = false;
+    }
+    SEN_HILOGI("Suspend done, pidCount:%{public}zu, disableCount:%{public}zu, resetCount:%{public}zu",
+        pids.size(), disableList.size(), resetList.size());
+    return isAllSuspend ? ERR_OK : SUSPEND_ERR;
+}
+
+ErrCode SensorPowerPolicy::ResumeSensors(const std::vector<int32_t> &pids)
 {
     CALL_LOG_ENTER;
+    bool isAllResume = true;
+    std::unordered_map<SensorDescription, bool> enableStateMap;
+    std::unordered_map<SensorDescription, std::vector<int32_t>> restoredPidMap;
+    std::lock_guard<std::mutex> pidSensorInfoLock(pidSensorInfoMutex_);
+    for (const auto &pid : pids) {
+        auto pidSensorInfoIt = pidSensorInfoMap_.find(pid);
+        if (pidSensorInfoIt == pidSensorInfoMap_.end()) {
+            SEN_HILOGD("Resume sensors failed, please suspend sensors first, pid:%{public}d", pid);
+            isAllResume = false;
+            continue;
+        }
+        for (const auto &sensorIt : pidSensorInfoIt->second) {
+            const SensorDescription &sensorDesc = sensorIt.first;
+            int64_t samplingPeriodNs = sensorIt.second.GetSamplingPeriodNs();
+            int64_t maxReportDelayNs = sensorIt.second.GetMaxReportDelayNs();
+            if (!CheckResumeParams(sensorDesc, samplingPeriodNs, maxReportDelayNs)) {
+                continue;
+            }
+            if (enableStateMap.find(sensorDesc) == enableStateMap.end()) {
+                enableStateMap[sensorDesc] = clientInfo_.GetSensorState(sensorDesc);
+            }
+            if (!sensorManager_.SaveSubscriber(sensorDesc, pid, samplingPeriodNs, maxReportDelayNs)) {
+                SEN_HILOGE("SaveSubscriber failed, sensorType:%{public}d", sensorDesc.sensorType);
+                continue;
+            }
+            restoredPidMap[sensorDesc].push_back(pid);
+        }
+    }
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    if (!restoredPidMap.empty()) {
+        sensorManager_.StartDataReportThread();
+    }
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
+    for (auto restoredIt = restoredPidMap.begin(); restoredIt != restoredPidMap.end();) {
+        const SensorDescription &sensorDesc = restoredIt->first;
+        bool isSuccess = true;
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+        isSuccess = sensorManager_.ResetBestSensorParams(sensorDesc);
+        if (isSuccess && !enableStateMap[sensorDesc]) {
+            auto ret = sensorHdiConnection_.EnableSensor(sensorDesc);
+            if (ret != ERR_OK) {
+                SEN_HILOGE("Hdi enable sensor failed, sensorType:%{public}d, ret:%{public}d",
+                    sensorDesc.sensorType, ret);
+                isSuccess = false;
+            }
+        }
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
+        if (isSuccess) {
+            ++restoredIt;
+            continue;
+        }
+        for (const auto &pid : restoredIt->second) {
+            clientInfo_.RemoveSubscriber(sensorDesc, pid);
+        }
+        restoredIt = restoredPidMap.erase(restoredIt);
+    }
+    for (const auto &pid : pids) {
+        auto pidSensorInfoIt = pidSensorInfoMap_.find(pid);
+        if (pidSensorInfoIt == pidSensorInfoMap_.end()) {
+            continue;
+        }
+        auto &sensorInfoMap = pidSensorInfoIt->second;
+        for (auto sensorIt = sensorInfoMap.begin(); sensorIt != sensorInfoMap.end();) {
+            auto restoredIt = restoredPidMap.find(sensorIt->first);
+            if ((restoredIt != restoredPidMap.end()) &&
+                (std::find(restoredIt->second.begin(), restoredIt->second.end(), pid) != restoredIt->second.end())) {
+                sensorIt = sensorInfoMap.erase(sensorIt);
+            } else {
+                SEN_HILOGE("Resume sensor failed, sensorType:%{public}d", sensorIt->first.sensorType);
+                ++sensorIt;
+            }
+        }
+        if (sensorInfoMap.empty()) {
+            pidSensorInfoMap_.erase(pidSensorInfoIt);
+        } else {
+            isAllResume = false;
+        }
+    }
+    SEN_HILOGI("Resume done, pidCount:%{public}zu, sensorCount:%{public}zu", pids.size(), restoredPidMap.size());
+    return isAllResume ? ERR_OK : RESUME_ERR;
+}
+
+bool SensorPowerPolicy::CheckResumeParams(const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
+    int64_t maxReportDelayNs)
+{
     if ((sensorDesc.sensorType == INVALID_SENSOR_ID) || (samplingPeriodNs <= 0) ||
         ((samplingPeriodNs != 0L) && (maxReportDelayNs / samplingPeriodNs > MAX_EVENT_COUNT))) {
         SEN_HILOGE("sensorType is invalid or maxReportDelayNs exceed the maximum value");
         return false;
     }
+    return true;
+}
+
+bool SensorPowerPolicy::Resume(int32_t pid, const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
+    int64_t maxReportDelayNs)
+{
+    CALL_LOG_ENTER;
+    if (!CheckResumeParams(sensorDesc, samplingPeriodNs, maxReportDelayNs)) {
+        return false;
+    }
     if (clientInfo_.GetSensorState(sensorDesc)) {
         SEN_HILOGD("Sensor is enable, sensorType:%{public}d", sensorDesc.sensorType);
         auto ret = RestoreSensorInfo(pid, sensorDesc, samplingPeriodNs, maxReportDelayNs);
@@ -201,11 +334,9 @@ ErrCode SensorPowerPolicy::ResetSensors()
     CALL_LOG_ENTER;
     std::vector<int32_t> suspendPidList = GetSuspendPidList();
     bool resetStatus = true;
-    for (const auto &pid : suspendPidList) {
-        if (ResumeSensors(pid) != ERR_OK) {
-            SEN_HILOGE("Reset pid sensors failed, pid:%{public}d", pid);
-            resetStatus = false;
-        }
+    if (!suspendPidList.empty() && (ResumeSensors(suspendPidList) != ERR_OK)) {
+        SEN_HILOGE("Reset pid sensors failed, pidCount:%{public}zu", suspendPidList.size());
+        resetStatus = false;
     }
     if (resetStatus) {
         SEN_HILOGI("Reset sensors success");
@@ -241,22 +372,93 @@ void SensorPowerPolicy::ReportActiveInfo(const ActiveInfo &activeInfo,
         SEN_HILOGE("Invalid activeInfo");
         return;
     }
-    NetPacket pkt(MessageId::ACTIVE_INFO);
-    pkt << activeInfo.GetPid() << activeInfo.GetSensorId() <<
-        activeInfo.GetSamplingPeriodNs() << activeInfo.GetMaxReportDelayNs();
-#ifdef OHOS_BUILD_ENABLE_RUST
-    if (StreamBufferChkRWError(pkt.streamBufferPtr_.get())) {
-#else
-    if (pkt.ChkRWError()) {
-#endif // OHOS_BUILD_ENABLE_RUST
-        SEN_HILOGE("Packet write data failed");
+    std::lock_guard<std::mutex> activeInfoLock(activeInfoMutex_);
+    if (activeInfoSenderStop_) {
+        SEN_HILOGW("Active info sender is stopped");
         return;
     }
     for (const auto &sess : sessionList) {
-        if (!sess->SendMsg(pkt)) {
-            SEN_HILOGE("Packet send failed");
+        CHKPC(sess);
+        std::deque<ActiveInfo> &infos = activeInfoQueueMap_[sess];
+        if (infos.size() >= MAX_ACTIVE_INFO_QUEUE_SIZE) {
+            SEN_HILOGW("Active info queue is full, drop oldest, pid:%{public}d", sess->GetPid());
+            infos.pop_front();
+        }
+        infos.push_back(activeInfo);
+    }
+    if (activeInfoQueueMap_.empty()) {
+        return;
+    }
+    if (!activeInfoSenderThread_.joinable()) {
+        activeInfoSenderThread_ = std::thread(&SensorPowerPolicy::ActiveInfoSenderThread, this);
+    }
+    activeInfoCondition_.notify_one();
+}
+
+void SensorPowerPolicy::StartActiveInfoSender()
+{
+    std::lock_guard<std::mutex> activeInfoLock(activeInfoMutex_);
+    activeInfoSenderStop_ = false;
+}
+
+void SensorPowerPolicy::StopActiveInfoSender()
+{
+    {
+        std::lock_guard<std::mutex> activeInfoLock(activeInfoMutex_);
+        activeInfoSenderStop_ = true;
+        activeInfoQueueMap_.clear();
+    }
+    activeInfoCondition_.notify_one();
+    if (activeInfoSenderThread_.joinable()) {
+        activeInfoSenderThread_.join();
+    }
+}
+
+void SensorPowerPolicy::ActiveInfoSenderThread()
+{
+    prctl(PR_SET_NAME, ACTIVE_INFO_THREAD_NAME.c_str());
+    std::unique_lock<std::mutex> activeInfoLock(activeInfoMutex_);
+    while (!activeInfoSenderStop_) {
+        if (activeInfoQueueMap_.empty()) {
+            activeInfoCondition_.wait(activeInfoLock, [this] {
+                return activeInfoSenderStop_ || !activeInfoQueueMap_.empty();
+            });
             continue;
         }
+        std::unordered_map<SessionPtr, std::deque<ActiveInfo>> pendingQueueMap;
+        pendingQueueMap.swap(activeInfoQueueMap_);
+        activeInfoLock.unlock();
+        for (auto &item : pendingQueueMap) {
+            SendActiveInfoQueue(item.first, item.second);
+        }
+        activeInfoLock.lock();
+    }
+}
+
+void SensorPowerPolicy::SendActiveInfoQueue(const SessionPtr &session, std::deque<ActiveInfo> &infos)
+{
+    CHKPV(session);
+    ActiveInfoRecord records[MAX_ACTIVE_INFO_BATCH];
+    NetPacket pkt(MessageId::ACTIVE_INFO);
+    while (!infos.empty()) {
+        size_t count = std::min(infos.size(), MAX_ACTIVE_INFO_BATCH);
+        for (size_t i = 0; i < count; ++i) {
+            const ActiveInfo &activeInfo = infos.front();
+            records[i].pid = activeInfo.GetPid();
+            records[i].sensorId = activeInfo.GetSensorId();
+            records[i].samplingPeriodNs = activeInfo.GetSamplingPeriodNs();
+            records[i].maxReportDelayNs = activeInfo.GetMaxReportDelayNs();
+            infos.pop_front();
+        }
+        pkt.Reset(MessageId::ACTIVE_INFO);
+        if (!EncodeMessage(pkt, records, count)) {
+            SEN_HILOGE("Packet write data failed");
+            return;
+        }
+        if (!session->SendMsg(pkt)) {
+            SEN_HILOGE("Packet send failed, pid:%{public}d, dropped:%{public}zu", session->GetPid(), infos.size());
+            return;
+        }
     }
 }
 
@@ -15,11 +15,15 @@
 
 #include "sensor_service.h"
 
+#include <algorithm>
 #include <charconv>
+#include <chrono>
 #include <cinttypes>
+#include <future>
 #include <string_ex.h>
 #include <sys/time.h>
 #include <tokenid_kit.h>
+#include <unistd.h>
 
 #ifdef HIVIEWDFX_HISYSEVENT_ENABLE
 #include "hisysevent.h"
@@ -47,14 +51,22 @@ auto g_sensorService = SensorDelayedSpSingleton<SensorService>::GetInstance();
 const bool G_REGISTER_RESULT = SystemAbility::MakeAndRegisterAbility(g_sensorService.GetRefPtr());
 constexpr int32_t INVALID_PID = -1;
 constexpr int64_t MAX_EVENT_COUNT = 1000;
+constexpr int64_t MAX_COALESCE_WINDOW_NS = 10000000000;
 constexpr int32_t SENSOR_ONLINE = 1;
 std::atomic_bool g_isRegister = false;
 constexpr int32_t SINGLE_DISPLAY_SMALL_FOLD = 4;
 constexpr int32_t SINGLE_DISPLAY_THREE_FOLD = 6;
 const std::string DEFAULTS_FOLD_TYPE = "0,0,0,0";
+constexpr int64_t HDI_READY_TIMEOUT_MS = 3000;
+const std::string SENSOR_LIST_CACHE_PATH = "/data/service/el1/public/sensors/sensor_list_cache";
 const std::set<int32_t> g_systemApiSensorCall = {
     SENSOR_TYPE_ID_COLOR, SENSOR_TYPE_ID_SAR, SENSOR_TYPE_ID_HEADPOSTURE
 };
+
+int64_t GetElapsedMs(std::chrono::steady_clock::time_point startTime)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
 } // namespace
 
 std::atomic_bool SensorService::isAccessTokenServiceActive_ = false;
@@ -69,6 +81,12 @@ SensorService::SensorService()
 
 SensorService::~SensorService()
 {
+    StopTeardownThread();
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    if (startupThread_.joinable()) {
+        startupThread_.join();
+    }
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
     UnloadMotionSensor();
 }
 
@@ -189,34 +207,37 @@ void SensorService::OnStart()
         SEN_HILOGW("SensorService has already started");
         return;
     }
-#ifdef HDF_DRIVERS_INTERFACE_SENSOR
-    if (!InitInterface()) {
-        SEN_HILOGE("Init interface error");
-    }
-    if (!InitDataCallback()) {
-        SEN_HILOGE("Init data callback error");
+    {
+        std::lock_guard<std::mutex> teardownLock(teardownMutex_);
+        teardownStop_ = false;
     }
-    if (!InitSensorList()) {
-        SEN_HILOGE("Init sensor list error");
+    {
+        std::lock_guard<std::mutex> startupLock(startupMutex_);
+        isHdiReady_ = false;
     }
-    if (!InitPlugCallback()) {
-        SEN_HILOGE("Init plug callback error");
+    POWER_POLICY.StartActiveInfoSender();
+    StartReactor();
+    SensorDump::GetInstance().ClearStartupPhases();
+    auto startTime = std::chrono::steady_clock::now();
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    if (LoadSensorListCache()) {
+        startupThread_ = std::thread([this] { this->InitHdi(); });
+    } else {
+        InitHdi();
     }
-    sensorDataProcesser_ = new (std::nothrow) SensorDataProcesser(sensorMap_);
-    CHKPV(sensorDataProcesser_);
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
     if (!InitSensorPolicy()) {
         SEN_HILOGE("Init sensor policy error");
     }
-#ifdef HDF_DRIVERS_INTERFACE_SENSOR
-    sensorManager_.InitSensorMap(sensorMap_, sensorDataProcesser_, reportDataCallback_);
-#else
+#ifndef HDF_DRIVERS_INTERFACE_SENSOR
     sensorManager_.InitSensorMap(sensorMap_);
+    SetHdiReady();
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
     if (!SystemAbility::Publish(SensorDelayedSpSingleton<SensorService>::GetInstance())) {
         SEN_HILOGE("Publish SensorService error");
         return;
     }
+    SensorDump::GetInstance().RecordStartupPhase("publish", GetElapsedMs(startTime));
     state_ = SensorServiceState::STATE_RUNNING;
 #ifdef MEMMGR_ENABLE
     AddSystemAbilityListener(MEMORY_MANAGER_SA_ID);
@@ -267,25 +288,114 @@ bool SensorService::InitDataCallback()
 
 bool SensorService::InitSensorList()
 {
-    std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
-    int32_t ret = sensorHdiConnection_.GetSensorList(sensors_);
+    std::vector<Sensor> sensors;
+    int32_t ret = sensorHdiConnection_.GetSensorList(sensors);
     if (ret != 0) {
         SEN_HILOGE("GetSensorList is failed");
         return false;
     }
-    {
-        std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
-        for (const auto &it : sensors_) {
-            if (!(sensorMap_.insert(std::pair<SensorDescription, Sensor>({
-                it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()}, it)).second)) {
-                SEN_HILOGW("sensorMap_ insert failed");
-            }
+    if (SetSensorList(sensors)) {
+        InvalidateSensorCatalog();
+    }
+    if (SensorCatalog::Save(SENSOR_LIST_CACHE_PATH, sensors) != ERR_OK) {
+        SEN_HILOGW("Save sensor list cache failed");
+    }
+    return true;
+}
+
+bool SensorService::SetSensorList(const std::vector<Sensor> &sensors)
+{
+    std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
+    if (!sensors_.empty() && SensorCatalog::IsSameList(sensors_, sensors)) {
+        SEN_HILOGI("Sensor list is unchanged, count:%{public}zu", sensors.size());
+        return false;
+    }
+    sensors_ = sensors;
+    std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
+    sensorMap_.clear();
+    for (const auto &it : sensors_) {
+        if (!(sensorMap_.insert(std::pair<SensorDescription, Sensor>({
+            it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()}, it)).second)) {
+            SEN_HILOGW("sensorMap_ insert failed");
         }
     }
     return true;
 }
+
+bool SensorService::LoadSensorListCache()
+{
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<Sensor> sensors;
+    if ((SensorCatalog::Restore(SENSOR_LIST_CACHE_PATH, sensors) != ERR_OK) || sensors.empty()) {
+        SEN_HILOGW("Sensor list cache is unavailable, enumerate synchronously");
+        return false;
+    }
+    SetSensorList(sensors);
+    SensorDump::GetInstance().RecordStartupPhase("list_cache", GetElapsedMs(startTime));
+    return true;
+}
+
+void SensorService::InitHdi()
+{
+    auto startTime = std::chrono::steady_clock::now();
+    if (!InitInterface()) {
+        SEN_HILOGE("Init interface error");
+    }
+    SensorDump::GetInstance().RecordStartupPhase("hdi_connect", GetElapsedMs(startTime));
+    auto listTask = std::async(std::launch::async, [this] {
+        auto listStartTime = std::chrono::steady_clock::now();
+        bool isSuccess = InitSensorList();
+        SensorDump::GetInstance().RecordStartupPhase("sensor_list", GetElapsedMs(listStartTime));
+        return isSuccess;
+    });
+    auto callbackStartTime = std::chrono::steady_clock::now();
+    if (!InitDataCallback()) {
+        SEN_HILOGE("Init data callback error");
+    }
+    SensorDump::GetInstance().RecordStartupPhase("hdi_callback", GetElapsedMs(callbackStartTime));
+    if (!listTask.get()) {
+        SEN_HILOGE("Init sensor list error");
+    }
+    // Plug events are applied on top of the installed list, so the callback is registered only after it
+    if (!InitPlugCallback()) {
+        SEN_HILOGE("Init plug callback error");
+    }
+    {
+        std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
+        sensorDataProcesser_ = new (std::nothrow) SensorDataProcesser(sensorMap_);
+        sensorManager_.InitSensorMap(sensorMap_, sensorDataProcesser_, reportDataCallback_);
+    }
+    SetHdiReady();
+    SensorDump::GetInstance().RecordStartupPhase("hdi_ready", GetElapsedMs(startTime));
+}
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
 
+void SensorService::SetHdiReady()
+{
+    {
+        std::lock_guard<std::mutex> startupLock(startupMutex_);
+        isHdiReady_ = true;
+    }
+    startupCondition_.notify_all();
+}
+
+bool SensorService::IsHdiReady()
+{
+    std::lock_guard<std::mutex> startupLock(startupMutex_);
+    return isHdiReady_;
+}
+
+bool SensorService::WaitHdiReady()
+{
+    std::unique_lock<std::mutex> startupLock(startupMutex_);
+    if (!startupCondition_.wait_for(startupLock, std::chrono::milliseconds(HDI_READY_TIMEOUT_MS),
+        [this] { return isHdiReady_; })) {
+        SEN_HILOGE("Wait hdi ready timeout");
+        return false;
+    }
+    return true;
+}
+
 bool SensorService::InitSensorPolicy()
 {
     return true;
@@ -300,12 +410,20 @@ void SensorService::OnStop()
     }
     state_ = SensorServiceState::STATE_STOPPED;
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    if (startupThread_.joinable()) {
+        startupThread_.join();
+    }
+    sensorManager_.StopReconfigThread();
     int32_t ret = sensorHdiConnection_.DestroyHdiConnection();
     if (ret != ERR_OK) {
         SEN_HILOGE("Destroy hdi connect fail");
     }
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
     UnregisterPermCallback();
+    InvalidateSensorCatalog();
+    POWER_POLICY.StopActiveInfoSender();
+    StopTeardownThread();
+    StopReactor();
 #ifdef MEMMGR_ENABLE
     Memory::MemMgrClient::GetInstance().NotifyProcessStatus(getpid(), PROCESS_TYPE_SA, PROCESS_STATUS_DIED,
         SENSOR_SERVICE_ABILITY_ID);
@@ -363,6 +481,7 @@ void SensorService::ReportOnChangeData(const SensorDescription &sensorDesc)
     auto sendRet = channel->SendData(&sensorData, sizeof(sensorData));
     if (sendRet != ERR_OK) {
         SEN_HILOGE("Send data failed");
+        channel->AddLostEventCount(1);
         return;
     }
 }
@@ -464,22 +583,64 @@ ErrCode SensorService::EnableSensor(const SensorDescriptionIPC &SensorDescriptio
     if (checkResult != ERR_OK) {
         return checkResult;
     }
+    if (!WaitHdiReady()) {
+        return ERR_NO_INIT;
+    }
+    int32_t pid = GetCallingPid();
+    std::lock_guard<std::mutex> serviceLock(serviceLock_);
+    ErrCode ret = EnableSensorInner(sensorDesc, samplingPeriodNs, maxReportDelayNs, pid);
+    UpdateChannelBufferSize(pid);
+    return ret;
+}
+
+ErrCode SensorService::EnableSensors(const std::vector<SensorEnableInfoIPC> &enableInfos,
+    std::vector<int32_t> &results)
+{
+    CALL_LOG_ENTER;
+    if (enableInfos.empty() || enableInfos.size() > static_cast<size_t>(MAX_SENSOR_COUNT)) {
+        SEN_HILOGE("Invalid enableInfos size:%{public}zu", enableInfos.size());
+        return PARAMETER_ERROR;
+    }
+    results.assign(enableInfos.size(), ERR_OK);
+    for (size_t i = 0; i < enableInfos.size(); ++i) {
+        const SensorDescriptionIPC &desc = enableInfos[i].sensorDesc;
+        results[i] = CheckAuthAndParameter({desc.deviceId, desc.sensorType, desc.sensorId, desc.location},
+            enableInfos[i].samplingPeriodNs, enableInfos[i].maxReportDelayNs);
+    }
+    if (!WaitHdiReady()) {
+        return ERR_NO_INIT;
+    }
     int32_t pid = GetCallingPid();
     std::lock_guard<std::mutex> serviceLock(serviceLock_);
+    for (size_t i = 0; i < enableInfos.size(); ++i) {
+        if (results[i] != ERR_OK) {
+            continue;
+        }
+        const SensorDescriptionIPC &desc = enableInfos[i].sensorDesc;
+        results[i] = EnableSensorInner({desc.deviceId, desc.sensorType, desc.sensorId, desc.location},
+            enableInfos[i].samplingPeriodNs, enableInfos[i].maxReportDelayNs, pid);
+    }
+    UpdateChannelBufferSize(pid);
+    return ERR_OK;
+}
+
+ErrCode SensorService::EnableSensorInner(const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
+    int64_t maxReportDelayNs, int32_t pid)
+{
     if (clientInfo_.GetSensorState(sensorDesc)) {
         return SensorReportEvent(sensorDesc, samplingPeriodNs, maxReportDelayNs, pid);
     }
     auto ret = SaveSubscriber(sensorDesc, samplingPeriodNs, maxReportDelayNs);
     if (ret != ERR_OK) {
         SEN_HILOGE("SaveSubscriber failed");
-        clientInfo_.RemoveSubscriber(sensorDesc, GetCallingPid());
+        clientInfo_.RemoveSubscriber(sensorDesc, pid);
         return ret;
     }
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
     ret = sensorHdiConnection_.EnableSensor(sensorDesc);
     if (ret != ERR_OK) {
         SEN_HILOGE("EnableSensor failed");
-        clientInfo_.RemoveSubscriber(sensorDesc, GetCallingPid());
+        clientInfo_.RemoveSubscriber(sensorDesc, pid);
         return ENABLE_SENSOR_ERR;
     }
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
@@ -529,7 +690,18 @@ ErrCode SensorService::DisableSensor(const SensorDescription &sensorDesc, int32_
         return CLIENT_PID_INVALID_ERR;
     }
     ReportSensorSysEvent(sensorDesc.sensorType, false, pid);
-    std::lock_guard<std::mutex> serviceLock(serviceLock_);
+    int32_t ret = ERR_OK;
+    {
+        std::lock_guard<std::mutex> serviceLock(serviceLock_);
+        ret = DisableSensorInner(sensorDesc, pid);
+        UpdateChannelBufferSize(pid);
+        ResetCritical();
+    }
+    return ret;
+}
+
+ErrCode SensorService::DisableSensorInner(const SensorDescription &sensorDesc, int32_t pid)
+{
     if (sensorManager_.IsOtherClientUsingSensor(sensorDesc, pid)) {
         SEN_HILOGW("Other client is using this sensor now, can't disable");
         return ERR_OK;
@@ -548,17 +720,31 @@ ErrCode SensorService::DisableSensor(const SensorDescription &sensorDesc, int32_
     int32_t uid = clientInfo_.GetUidByPid(pid);
     clientInfo_.DestroyCmd(uid);
     clientInfo_.ClearDataQueue(sensorDesc);
-    int32_t ret = sensorManager_.AfterDisableSensor(sensorDesc);
+    return sensorManager_.AfterDisableSensor(sensorDesc);
+}
+
+void SensorService::UpdateChannelBufferSize(int32_t pid)
+{
+    sptr<SensorBasicDataChannel> channel = clientInfo_.GetSensorChannelByPid(pid);
+    if (channel == nullptr) {
+        return;
+    }
+    if (channel->SetSendBufferSize(clientInfo_.ComputeChannelBufferSize(pid)) != ERR_OK) {
+        SEN_HILOGW("Resize channel buffer failed, pid:%{public}d", pid);
+    }
+}
+
+void SensorService::ResetCritical()
+{
 #ifdef MEMMGR_ENABLE
     if (isMemoryMgrServiceActive_ && !clientInfo_.IsClientSubscribe() && isCritical_) {
         if (Memory::MemMgrClient::GetInstance().SetCritical(getpid(), false, SENSOR_SERVICE_ABILITY_ID) != ERR_OK) {
             SEN_HILOGE("SetCritical failed");
-            return ret;
+            return;
         }
         isCritical_ = false;
     }
 #endif // MEMMGR_ENABLE
-    return ret;
 }
 
 ErrCode SensorService::DisableSensor(const SensorDescriptionIPC &SensorDescriptionIPC)
@@ -570,6 +756,64 @@ ErrCode SensorService::DisableSensor(const SensorDescriptionIPC &SensorDescripti
         .sensorId = SensorDescriptionIPC.sensorId,
         .location = SensorDescriptionIPC.location
     };
+    ErrCode checkResult = CheckDisableAuth(sensorDesc);
+    if (checkResult != ERR_OK) {
+        return checkResult;
+    }
+    if (!WaitHdiReady()) {
+        return ERR_NO_INIT;
+    }
+    return DisableSensor(sensorDesc, GetCallingPid());
+}
+
+ErrCode SensorService::DisableSensors(const std::vector<SensorDescriptionIPC> &sensorDescs,
+    std::vector<int32_t> &results)
+{
+    CALL_LOG_ENTER;
+    if (sensorDescs.empty() || sensorDescs.size() > static_cast<size_t>(MAX_SENSOR_COUNT)) {
+        SEN_HILOGE("Invalid sensorDescs size:%{public}zu", sensorDescs.size());
+        return PARAMETER_ERROR;
+    }
+    int32_t pid = GetCallingPid();
+    if (pid < 0) {
+        SEN_HILOGE("pid is invalid, pid:%{public}d", pid);
+        return CLIENT_PID_INVALID_ERR;
+    }
+    results.assign(sensorDescs.size(), ERR_OK);
+    for (size_t i = 0; i < sensorDescs.size(); ++i) {
+        SensorDescription sensorDesc = {sensorDescs[i].deviceId, sensorDescs[i].sensorType,
+            sensorDescs[i].sensorId, sensorDescs[i].location};
+        results[i] = CheckDisableAuth(sensorDesc);
+        if (results[i] != ERR_OK) {
+            continue;
+        }
+        if (!(CheckSensorId(sensorDesc) || clientInfo_.GetSensorState(sensorDesc))) {
+            SEN_HILOGE("sensorDesc is invalid");
+            results[i] = ERR_NO_INIT;
+            continue;
+        }
+        ReportSensorSysEvent(sensorDesc.sensorType, false, pid);
+    }
+    if (!WaitHdiReady()) {
+        return ERR_NO_INIT;
+    }
+    {
+        std::lock_guard<std::mutex> serviceLock(serviceLock_);
+        for (size_t i = 0; i < sensorDescs.size(); ++i) {
+            if (results[i] != ERR_OK) {
+                continue;
+            }
+            results[i] = DisableSensorInner({sensorDescs[i].deviceId, sensorDescs[i].sensorType,
+                sensorDescs[i].sensorId, sensorDescs[i].location}, pid);
+        }
+        UpdateChannelBufferSize(pid);
+        ResetCritical();
+    }
+    return ERR_OK;
+}
+
+ErrCode SensorService::CheckDisableAuth(const SensorDescription &sensorDesc)
+{
     if ((sensorDesc.sensorType == SENSOR_TYPE_ID_COLOR || sensorDesc.sensorType == SENSOR_TYPE_ID_SAR ||
             sensorDesc.sensorType > GL_SENSOR_TYPE_PRIVATE_MIN_VALUE) &&
         !IsSystemCalling()) {
@@ -586,7 +830,7 @@ ErrCode SensorService::DisableSensor(const SensorDescriptionIPC &SensorDescripti
         SEN_HILOGE("sensorType:%{public}d grant failed, ret:%{public}d", sensorDesc.sensorType, ret);
         return PERMISSION_DENIED;
     }
-    return DisableSensor(sensorDesc, GetCallingPid());
+    return ERR_OK;
 }
 
 ErrCode SensorService::GetSensorList(std::vector<Sensor> &sensorList)
@@ -614,10 +858,19 @@ ErrCode SensorService::GetSensorListByDevice(int32_t deviceId, std::vector<Senso
                 singleDevSensors.push_back(sensor);
             }
         }
+        // A device the HDI did not know stays unknown until the next plug event
+        if (singleDevSensors.empty() && (unknownDeviceIds_.count(deviceId) != 0)) {
+            SEN_HILOGD("Unknown deviceId:%{public}d", deviceId);
+            return ERR_OK;
+        }
     }
 
     if (singleDevSensors.empty()) {
         std::vector<Sensor> sensors = GetSensorListByDevice(deviceId);
+        if (sensors.empty() && IsHdiReady()) {
+            std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
+            unknownDeviceIds_.insert(deviceId);
+        }
         int32_t sensorCount = static_cast<int32_t>(sensors.size());
         for (int32_t i = 0; i < sensorCount; ++i) {
             singleDevSensors.push_back(sensors[i]);
@@ -626,67 +879,101 @@ ErrCode SensorService::GetSensorListByDevice(int32_t deviceId, std::vector<Senso
     return ERR_OK;
 }
 
+ErrCode SensorService::GetSensorCatalog(int32_t &catalogFd)
+{
+    CALL_LOG_ENTER;
+    std::unique_lock<std::mutex> catalogLock(catalogMutex_);
+    if (catalogFd_ < 0) {
+        // Refreshing the list may invalidate the catalog, which takes catalogMutex_
+        catalogLock.unlock();
+        std::vector<Sensor> sensors = GetSensorList();
+        if (sensors.size() > static_cast<size_t>(MAX_SENSOR_COUNT)) {
+            sensors.resize(MAX_SENSOR_COUNT);
+        }
+        catalogLock.lock();
+        if (catalogFd_ < 0) {
+            catalogFd_ = SensorCatalog::Publish(sensors, catalogGeneration_, catalogView_);
+        }
+        if (catalogFd_ < 0) {
+            SEN_HILOGE("Publish sensor catalog failed");
+            return ERROR;
+        }
+    }
+    catalogFd = dup(catalogFd_);
+    if (catalogFd < 0) {
+        SEN_HILOGE("dup catalog fd failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    return ERR_OK;
+}
+
+void SensorService::InvalidateSensorCatalog()
+{
+    std::lock_guard<std::mutex> catalogLock(catalogMutex_);
+    ++catalogGeneration_;
+    // Clients still mapping this snapshot see the flag and fetch the next generation on their next query
+    catalogView_.MarkStale();
+    catalogView_.Unmap();
+    if (catalogFd_ >= 0) {
+        close(catalogFd_);
+        catalogFd_ = -1;
+    }
+}
+
 std::vector<Sensor> SensorService::GetSensorListByDevice(int32_t deviceId)
 {
     CALL_LOG_ENTER;
-    std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
-#ifdef HDF_DRIVERS_INTERFACE_SENSOR
     std::vector<Sensor> singleDevSensors;
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    // The HDI connection is set up on the startup thread, so it is queried only once startup has finished
+    if (!IsHdiReady()) {
+        SEN_HILOGW("Hdi is not ready, deviceId:%{public}d", deviceId);
+        return singleDevSensors;
+    }
     int32_t ret = sensorHdiConnection_.GetSensorListByDevice(deviceId, singleDevSensors);
     if (ret != 0 || singleDevSensors.empty()) {
         SEN_HILOGW("GetSensorListByDevice is failed or empty");
-        return sensors_;
-    }
-    for (const auto& newSensor : singleDevSensors) {
-        bool found = false;
-        for (auto& oldSensor : sensors_) {
-            if (oldSensor.GetSensorId() == newSensor.GetSensorId() &&
-                oldSensor.GetDeviceId() == newSensor.GetDeviceId() &&
-                oldSensor.GetSensorTypeId() == newSensor.GetSensorTypeId()) {
-                SEN_HILOGD("Sensor found in sensorList_");
-                found = true;
-                break;
-            }
-        }
-        if (!found) {
-            SEN_HILOGD("Sensor not found in sensorList_");
-                found = true;
-            sensors_.push_back(newSensor);
-        }
+        return {};
     }
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
-
+    std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
+    std::vector<Sensor> addedSensors;
     std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
-    for (const auto &it : sensors_) {
-        auto iter = sensorMap_.find({it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()});
+    for (const auto &sensor : singleDevSensors) {
+        SensorDescription sensorDesc = {
+            sensor.GetDeviceId(), sensor.GetSensorTypeId(), sensor.GetSensorId(), sensor.GetLocation()
+        };
+        auto iter = sensorMap_.find(sensorDesc);
         if (iter != sensorMap_.end()) {
-            iter->second = it;
-        } else {
-            sensorMap_.insert(std::pair<SensorDescription, Sensor>(
-                {it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()}, it));
-            if (sensorDataProcesser_ != nullptr) {
-                sensorDataProcesser_->UpdateSensorMap(sensorMap_);
-            }
+            iter->second = sensor;
+            continue;
         }
+        SEN_HILOGD("Sensor not found in sensorMap_");
+        sensors_.push_back(sensor);
+        sensorMap_.insert(std::pair<SensorDescription, Sensor>(sensorDesc, sensor));
+        addedSensors.push_back(sensor);
+    }
+    if (sensorDataProcesser_ != nullptr) {
+        sensorDataProcesser_->AddSensors(addedSensors);
     }
     return singleDevSensors;
 }
 
 std::vector<Sensor> SensorService::GetSensorList()
 {
-    std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
-    int32_t ret = sensorHdiConnection_.GetSensorList(sensors_);
-    if (ret != 0) {
-        SEN_HILOGE("GetSensorList is failed");
-        return sensors_;
+    // Until startup has enumerated the HDI the restored cache is served as is
+    if (IsHdiReady()) {
+        std::vector<Sensor> sensors;
+        int32_t ret = sensorHdiConnection_.GetSensorList(sensors);
+        if ((ret != 0) || sensors.empty()) {
+            SEN_HILOGE("GetSensorList is failed or empty, ret:%{public}d", ret);
+        } else if (SetSensorList(sensors)) {
+            InvalidateSensorCatalog();
+        }
     }
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
-    for (const auto &it : sensors_) {
-        std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
-        sensorMap_.insert(std::pair<SensorDescription, Sensor>({
-            it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()}, it));
-    }
+    std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
     return sensors_;
 }
 
@@ -713,6 +1000,7 @@ ErrCode SensorService::TransferDataChannel(int32_t sendFd, const sptr<IRemoteObj
         return UPDATE_SENSOR_CHANNEL_ERR;
     }
     sensorBasicDataChannel->SetSensorStatus(true);
+    AddDataChannel(sensorBasicDataChannel);
     std::string packageName("");
     sensorManager_.GetPackageName(callerToken, packageName, isAccessTokenServiceActive_);
     SEN_HILOGI("Calling packageName:%{public}s", packageName.c_str());
@@ -731,6 +1019,10 @@ ErrCode SensorService::DestroySensorChannel(const sptr<IRemoteObject> &sensorCli
         return CLIENT_PID_INVALID_ERR;
     }
     std::lock_guard<std::mutex> serviceLock(serviceLock_);
+    sptr<SensorBasicDataChannel> channel = clientInfo_.GetSensorChannelByPid(clientPid);
+    if (channel != nullptr) {
+        DelDataChannel(channel);
+    }
     bool destroyRet = clientInfo_.DestroySensorChannel(clientPid);
     if (!destroyRet) {
         SEN_HILOGE("DestroySensorChannel is failed");
@@ -751,17 +1043,82 @@ void SensorService::ProcessDeathObserver(const wptr<IRemoteObject> &object)
         SEN_HILOGE("pid is invalid");
         return;
     }
-    POWER_POLICY.DeleteDeathPidSensorInfo(pid);
     SEN_HILOGI("pid is %{public}d", pid);
+    clientInfo_.MarkSensorChannelDead(pid);
+    std::lock_guard<std::mutex> teardownLock(teardownMutex_);
+    if (teardownStop_) {
+        SEN_HILOGW("Service is stopping, skip teardown, pid:%{public}d", pid);
+        return;
+    }
+    teardownQueue_.emplace_back(pid, client);
+    if (!teardownThread_.joinable()) {
+        teardownThread_ = std::thread([this] { this->TeardownThread(); });
+    }
+    teardownCondition_.notify_one();
+}
+
+void SensorService::TeardownThread()
+{
+    std::unique_lock<std::mutex> teardownLock(teardownMutex_);
+    while (true) {
+        teardownCondition_.wait(teardownLock, [this] { return teardownStop_ || !teardownQueue_.empty(); });
+        if (teardownQueue_.empty()) {
+            return;
+        }
+        auto task = teardownQueue_.front();
+        teardownQueue_.pop_front();
+        teardownLock.unlock();
+        TeardownClient(task.first, task.second);
+        teardownLock.lock();
+    }
+}
+
+void SensorService::StopTeardownThread()
+{
+    {
+        std::lock_guard<std::mutex> teardownLock(teardownMutex_);
+        teardownStop_ = true;
+    }
+    teardownCondition_.notify_one();
+    if (teardownThread_.joinable()) {
+        teardownThread_.join();
+    }
+}
+
+void SensorService::TeardownClient(int32_t pid, sptr<IRemoteObject> client)
+{
+    CALL_LOG_ENTER;
+    if (!WaitHdiReady()) {
+        SEN_HILOGW("Hdi is not ready, teardown without disabling sensors, pid:%{public}d", pid);
+    }
+    POWER_POLICY.DeleteDeathPidSensorInfo(pid);
+    PermissionUtil::GetInstance().InvalidateToken(clientInfo_.GetTokenIdByPid(pid));
     std::vector<SensorDescription> activeSensors = clientInfo_.GetSensorIdByPid(pid);
-    for (size_t i = 0; i < activeSensors.size(); ++i) {
-        int32_t ret = DisableSensor(activeSensors[i], pid);
-        if (ret != ERR_OK) {
-            SEN_HILOGE("DisableSensor failed, ret:%{public}d", ret);
+    std::vector<SensorDescription> disableSensors;
+    for (const auto &sensorDesc : activeSensors) {
+        if (!(CheckSensorId(sensorDesc) || clientInfo_.GetSensorState(sensorDesc))) {
+            SEN_HILOGE("sensorDesc is invalid, sensorType:%{public}d", sensorDesc.sensorType);
+            continue;
         }
+        ReportSensorSysEvent(sensorDesc.sensorType, false, pid);
+        disableSensors.push_back(sensorDesc);
+    }
+    {
+        std::lock_guard<std::mutex> serviceLock(serviceLock_);
+        for (const auto &sensorDesc : disableSensors) {
+            int32_t ret = DisableSensorInner(sensorDesc, pid);
+            if (ret != ERR_OK) {
+                SEN_HILOGE("DisableSensor failed, ret:%{public}d", ret);
+            }
+        }
+        ResetCritical();
     }
     DelSession(pid);
     clientInfo_.DelActiveInfoCBPid(pid);
+    sptr<SensorBasicDataChannel> channel = clientInfo_.GetSensorChannelByPid(pid);
+    if (channel != nullptr) {
+        DelDataChannel(channel);
+    }
     clientInfo_.DestroySensorChannel(pid);
     clientInfo_.DestroyClientPid(client);
     clientInfo_.DestroyCmd(clientInfo_.GetUidByPid(pid));
@@ -817,23 +1174,19 @@ int32_t SensorService::Dump(int32_t fd, const std::vector<std::u16string> &args)
         [](const std::u16string &arg) {
         return Str16ToStr8(arg);
     });
+    std::vector<SessionInfo> sessionInfo;
+    GetSessionInfo(sessionInfo);
     std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
-    sensorDump.ParseCommand(fd, argList, sensors_, clientInfo_);
+    sensorDump.ParseCommand(fd, argList, sensors_, sessionInfo, clientInfo_);
     return ERR_OK;
 }
 
 ErrCode SensorService::SuspendSensors(int32_t pid)
 {
     CALL_LOG_ENTER;
-    PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
-    if (!permissionUtil.IsNativeToken(GetCallingTokenID())) {
-        SEN_HILOGE("TokenType is not TOKEN_NATIVE");
-        return PERMISSION_DENIED;
-    }
-    int32_t ret = permissionUtil.CheckManageSensorPermission(GetCallingTokenID());
-    if (ret != PERMISSION_GRANTED) {
-        SEN_HILOGE("Check manage sensor permission failed, ret:%{public}d", ret);
-        return PERMISSION_DENIED;
+    ErrCode ret = CheckManageSensorAuth();
+    if (ret != ERR_OK) {
+        return ret;
     }
     if (pid < 0) {
         SEN_HILOGE("Pid is invalid");
@@ -845,6 +1198,47 @@ ErrCode SensorService::SuspendSensors(int32_t pid)
 ErrCode SensorService::ResumeSensors(int32_t pid)
 {
     CALL_LOG_ENTER;
+    ErrCode ret = CheckManageSensorAuth();
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    if (pid < 0) {
+        SEN_HILOGE("Pid is invalid");
+        return CLIENT_PID_INVALID_ERR;
+    }
+    return POWER_POLICY.ResumeSensors(pid);
+}
+
+ErrCode SensorService::SuspendSensorsBatch(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    ErrCode ret = CheckManageSensorAuth();
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    if (pids.empty() || std::any_of(pids.begin(), pids.end(), [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid list is invalid");
+        return CLIENT_PID_INVALID_ERR;
+    }
+    return POWER_POLICY.SuspendSensors(pids);
+}
+
+ErrCode SensorService::ResumeSensorsBatch(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    ErrCode ret = CheckManageSensorAuth();
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    if (pids.empty() || std::any_of(pids.begin(), pids.end(), [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid list is invalid");
+        return CLIENT_PID_INVALID_ERR;
+    }
+    return POWER_POLICY.ResumeSensors(pids);
+}
+
+ErrCode SensorService::CheckManageSensorAuth()
+{
     PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
     if (!permissionUtil.IsNativeToken(GetCallingTokenID())) {
         SEN_HILOGE("TokenType is not TOKEN_NATIVE");
@@ -855,11 +1249,10 @@ ErrCode SensorService::ResumeSensors(int32_t pid)
         SEN_HILOGE("Check manage sensor permission failed, ret:%{public}d", ret);
         return PERMISSION_DENIED;
     }
-    if (pid < 0) {
-        SEN_HILOGE("Pid is invalid");
-        return CLIENT_PID_INVALID_ERR;
+    if (!WaitHdiReady()) {
+        return ERR_NO_INIT;
     }
-    return POWER_POLICY.ResumeSensors(pid);
+    return ERR_OK;
 }
 
 ErrCode SensorService::GetActiveInfoList(int32_t pid, std::vector<ActiveInfo> &activeInfoList)
@@ -955,6 +1348,9 @@ ErrCode SensorService::ResetSensors()
         SEN_HILOGE("Check manage sensor permission failed, ret:%{public}d", ret);
         return PERMISSION_DENIED;
     }
+    if (!WaitHdiReady()) {
+        return ERR_NO_INIT;
+    }
     return POWER_POLICY.ResetSensors();
 }
 
@@ -992,6 +1388,7 @@ bool SensorService::RegisterPermCallback(int32_t sensorType)
         SEN_HILOGE("RegisterPermStateChangeCallback fail");
         return false;
     }
+    PermissionUtil::GetInstance().SetPermStateListened(true);
     return true;
 }
 
@@ -1004,6 +1401,7 @@ void SensorService::UnregisterPermCallback()
         SEN_HILOGE("UnregisterPermStateChangeCallback fail");
         return;
     }
+    PermissionUtil::GetInstance().SetPermStateListened(false);
     g_isRegister = false;
 }
 
@@ -1011,6 +1409,7 @@ void SensorService::PermStateChangeCb::PermStateChangeCallback(Security::AccessT
 {
     CALL_LOG_ENTER;
     CHKPV(server_);
+    PermissionUtil::GetInstance().InvalidatePermission(result.tokenID, result.permissionName);
     server_->clientInfo_.ChangeSensorPerm(result.tokenID, result.permissionName,
         (result.permStateChangeType != 0));
 }
@@ -1041,19 +1440,57 @@ ErrCode SensorService::DestroyClientRemoteObject(const sptr<IRemoteObject> &sens
     return ERR_OK;
 }
 
+ErrCode SensorService::SetCoalesceWindow(const SensorDescriptionIPC &SensorDescriptionIPC, int64_t windowNs)
+{
+    CALL_LOG_ENTER;
+    if ((windowNs < 0L) || (windowNs > MAX_COALESCE_WINDOW_NS)) {
+        SEN_HILOGE("windowNs is invalid, windowNs:%{public}" PRId64, windowNs);
+        return PARAMETER_ERROR;
+    }
+    SensorDescription sensorDesc {
+        .deviceId = SensorDescriptionIPC.deviceId,
+        .sensorType = SensorDescriptionIPC.sensorType,
+        .sensorId = SensorDescriptionIPC.sensorId,
+        .location = SensorDescriptionIPC.location
+    };
+    ErrCode checkResult = CheckAuthAndParameter(sensorDesc, 0L, 0L);
+    if (checkResult != ERR_OK) {
+        return checkResult;
+    }
+    int32_t pid = GetCallingPid();
+    std::lock_guard<std::mutex> serviceLock(serviceLock_);
+    if (!clientInfo_.SetCoalesceWindow(sensorDesc, pid, windowNs)) {
+        SEN_HILOGE("SetCoalesceWindow failed, sensorType:%{public}d, pid:%{public}d", sensorDesc.sensorType, pid);
+        return ERR_NO_INIT;
+    }
+    return ERR_OK;
+}
+
 void SensorService::ReportPlugEventCallback(const SensorPlugInfo &info)
 {
     CALL_LOG_ENTER;
+    SensorDescription sensorDesc = {
+        info.deviceSensorInfo.deviceId, info.deviceSensorInfo.sensorType,
+        info.deviceSensorInfo.sensorId, info.deviceSensorInfo.location
+    };
+    {
+        std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
+        unknownDeviceIds_.clear();
+    }
     if (info.status == SENSOR_ONLINE) {
-        auto it = sensorMap_.find({info.deviceSensorInfo.deviceId, info.deviceSensorInfo.sensorType,
-            info.deviceSensorInfo.sensorId, info.deviceSensorInfo.location});
-        if (it == sensorMap_.end()) {
+        bool isKnown = false;
+        {
+            std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
+            isKnown = (sensorMap_.find(sensorDesc) != sensorMap_.end());
+        }
+        if (!isKnown) {
             GetSensorListByDevice(info.deviceSensorInfo.deviceId);
         }
     } else {
         if (!sensorHdiConnection_.PlugEraseSensorData(info)) {
             SEN_HILOGW("sensorHdiConnection Cache update failure");
         }
+        std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
         std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
         auto it = std::find_if(sensors_.begin(), sensors_.end(), [&](const Sensor& sensor) {
             return sensor.GetDeviceId() == info.deviceSensorInfo.deviceId &&
@@ -1063,12 +1500,12 @@ void SensorService::ReportPlugEventCallback(const SensorPlugInfo &info)
         if (it != sensors_.end()) {
             sensors_.erase(it);
         }
-        auto iter = sensorMap_.find({info.deviceSensorInfo.deviceId, info.deviceSensorInfo.sensorType,
-            info.deviceSensorInfo.sensorId, info.deviceSensorInfo.location});
-        if (iter != sensorMap_.end()) {
-            sensorMap_.erase(iter);
+        sensorMap_.erase(sensorDesc);
+        if (sensorDataProcesser_ != nullptr) {
+            sensorDataProcesser_->RemoveSensor(sensorDesc);
         }
     }
+    InvalidateSensorCatalog();
     struct timeval curTime;
     curTime.tv_sec = 0;
     curTime.tv_usec = 0;
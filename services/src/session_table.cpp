@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "session_table.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SessionTable"
+
+namespace OHOS {
+namespace Sensors {
+SessionTable::Shard &SessionTable::GetShard(std::array<Shard, SHARD_COUNT> &shards, int32_t key)
+{
+    return shards[static_cast<uint32_t>(key) % SHARD_COUNT];
+}
+
+bool SessionTable::Insert(SessionPtr sess)
+{
+    CHKPF(sess);
+    if (count_.fetch_add(1, std::memory_order_acq_rel) >= MAX_SESSION_COUNT) {
+        count_.fetch_sub(1, std::memory_order_acq_rel);
+        SEN_HILOGE("Too many clients, size:%{public}zu", MAX_SESSION_COUNT);
+        return false;
+    }
+    int32_t fd = sess->GetFd();
+    {
+        Shard &fdShard = GetShard(fdShards_, fd);
+        std::lock_guard<std::mutex> fdLock(fdShard.mutex);
+        if (!fdShard.sessions.insert_or_assign(fd, sess).second) {
+            count_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+    int32_t pid = sess->GetPid();
+    Shard &pidShard = GetShard(pidShards_, pid);
+    std::lock_guard<std::mutex> pidLock(pidShard.mutex);
+    pidShard.sessions[pid] = sess;
+    return true;
+}
+
+SessionPtr SessionTable::FindByFd(int32_t fd)
+{
+    Shard &shard = GetShard(fdShards_, fd);
+    std::lock_guard<std::mutex> shardLock(shard.mutex);
+    auto it = shard.sessions.find(fd);
+    return it == shard.sessions.end() ? nullptr : it->second;
+}
+
+SessionPtr SessionTable::FindByPid(int32_t pid)
+{
+    Shard &shard = GetShard(pidShards_, pid);
+    std::lock_guard<std::mutex> shardLock(shard.mutex);
+    auto it = shard.sessions.find(pid);
+    return it == shard.sessions.end() ? nullptr : it->second;
+}
+
+SessionPtr SessionTable::EraseByPid(int32_t pid)
+{
+    SessionPtr sess = nullptr;
+    {
+        Shard &pidShard = GetShard(pidShards_, pid);
+        std::lock_guard<std::mutex> pidLock(pidShard.mutex);
+        auto it = pidShard.sessions.find(pid);
+        if (it == pidShard.sessions.end()) {
+            return nullptr;
+        }
+        sess = it->second;
+        pidShard.sessions.erase(it);
+    }
+    CHKPP(sess);
+    int32_t fd = sess->GetFd();
+    Shard &fdShard = GetShard(fdShards_, fd);
+    std::lock_guard<std::mutex> fdLock(fdShard.mutex);
+    auto it = fdShard.sessions.find(fd);
+    if ((it != fdShard.sessions.end()) && (it->second == sess)) {
+        fdShard.sessions.erase(it);
+        count_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    return sess;
+}
+
+std::vector<SessionPtr> SessionTable::GetAll()
+{
+    std::vector<SessionPtr> sessions;
+    sessions.reserve(Size());
+    for (auto &shard : fdShards_) {
+        std::lock_guard<std::mutex> shardLock(shard.mutex);
+        for (const auto &item : shard.sessions) {
+            sessions.push_back(item.second);
+        }
+    }
+    return sessions;
+}
+
+std::vector<SessionPtr> SessionTable::Clear()
+{
+    std::vector<SessionPtr> sessions;
+    for (auto &shard : pidShards_) {
+        std::lock_guard<std::mutex> shardLock(shard.mutex);
+        shard.sessions.clear();
+    }
+    for (auto &shard : fdShards_) {
+        std::lock_guard<std::mutex> shardLock(shard.mutex);
+        for (auto &item : shard.sessions) {
+            sessions.push_back(std::move(item.second));
+        }
+        shard.sessions.clear();
+    }
+    count_.store(0, std::memory_order_release);
+    return sessions;
+}
+
+size_t SessionTable::Size() const
+{
+    return count_.load(std::memory_order_acquire);
+}
+} // namespace Sensors
+} // namespace OHOS
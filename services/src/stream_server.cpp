@@ -17,6 +17,9 @@
 
 #include <cinttypes>
 
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/prctl.h>
 #include <sys/socket.h>
 
 #include "sensor_errors.h"
@@ -29,57 +32,60 @@ namespace Sensors {
 namespace {
 constexpr int32_t INVALID_PID = -1;
 constexpr int32_t INVALID_FD = -1;
+constexpr int32_t MAX_REACTOR_EVENT_SIZE = 16;
+constexpr uint32_t SESSION_REACTOR_EVENTS = EPOLLRDHUP;
+constexpr uint32_t DATA_CHANNEL_REACTOR_EVENTS = EPOLLIN | EPOLLRDHUP;
+const std::string REACTOR_THREAD_NAME = "OS_SenReactor";
 } // namespace
 
 StreamServer::~StreamServer()
 {
     CALL_LOG_ENTER;
-    std::lock_guard<std::mutex> sessionLock(sessionMutex_);
-    idxPidMap_.clear();
-    for (const auto &item : sessionsMap_) {
-        if (item.second == nullptr) {
+    StopReactor();
+    {
+        std::lock_guard<std::mutex> dataChannelLock(dataChannelMutex_);
+        dataChannelMap_.clear();
+    }
+    for (const auto &sess : sessionTable_.Clear()) {
+        if (sess == nullptr) {
             SEN_HILOGE("SessionPtr is null");
             continue;
         }
-        item.second->Close();
+        sess->SetWritableNotifier(nullptr);
+        sess->Close();
     }
-    sessionsMap_.clear();
 }
 
 int32_t StreamServer::GetClientFd(int32_t pid)
 {
-    std::lock_guard<std::mutex> sessionLock(sessionMutex_);
-    auto it = idxPidMap_.find(pid);
-    return it == idxPidMap_.end() ? INVALID_FD : it->second;
+    SessionPtr sess = sessionTable_.FindByPid(pid);
+    return sess == nullptr ? INVALID_FD : sess->GetFd();
 }
 
 int32_t StreamServer::GetClientPid(int32_t fd)
 {
-    std::lock_guard<std::mutex> sessionLock(sessionMutex_);
-    auto it = sessionsMap_.find(fd);
-    return it == sessionsMap_.end() ? INVALID_PID : it->second->GetPid();
+    SessionPtr sess = sessionTable_.FindByFd(fd);
+    return sess == nullptr ? INVALID_PID : sess->GetPid();
 }
 
 SessionPtr StreamServer::GetSession(int32_t fd)
 {
-    std::lock_guard<std::mutex> sessionLock(sessionMutex_);
-    auto it = sessionsMap_.find(fd);
-    if (it == sessionsMap_.end()) {
+    SessionPtr sess = sessionTable_.FindByFd(fd);
+    if (sess == nullptr) {
         SEN_HILOGE("Session not found");
         return nullptr;
     }
-    CHKPP(it->second);
-    return it->second->GetSharedPtr();
+    return sess;
 }
 
 SessionPtr StreamServer::GetSessionByPid(int32_t pid)
 {
-    int32_t fd = GetClientFd(pid);
-    if (fd <= 0) {
+    SessionPtr sess = sessionTable_.FindByPid(pid);
+    if (sess == nullptr) {
         SEN_HILOGE("Session not found");
         return nullptr;
     }
-    return GetSession(fd);
+    return sess;
 }
 
 int32_t StreamServer::AddSocketPairInfo(int32_t uid, int32_t pid, int32_t tokenType,
@@ -147,37 +153,284 @@ bool StreamServer::AddSession(SessionPtr sess)
         SEN_HILOGE("Pid is invalid");
         return false;
     }
-    std::lock_guard<std::mutex> sessionLock(sessionMutex_);
-    if (sessionsMap_.size() > MAX_SESSON_ALARM) {
-        SEN_HILOGE("Too many clients, size:%{public}zu", sessionsMap_.size());
+    if (!sessionTable_.Insert(sess)) {
+        return false;
+    }
+    if (sessionTable_.Size() > MAX_SESSON_ALARM) {
+        SEN_HILOGW("Many clients connected, size:%{public}zu", sessionTable_.Size());
+    }
+    if (!AddReactorFd(fd, SESSION_REACTOR_EVENTS)) {
+        SEN_HILOGE("Session is not watched by reactor, fd:%{public}d", fd);
+        sessionTable_.EraseByPid(pid);
         return false;
     }
-    idxPidMap_[pid] = fd;
-    sessionsMap_[fd] = sess;
+    sess->SetWritableNotifier([this](int32_t sessionFd, bool watchWritable) {
+        WatchWritable(sessionFd, SESSION_REACTOR_EVENTS, watchWritable);
+    });
     return true;
 }
 
 void StreamServer::DelSession(int32_t pid)
 {
     CALL_LOG_ENTER;
-    std::lock_guard<std::mutex> sessionLock(sessionMutex_);
-    auto pidIt = idxPidMap_.find(pid);
-    if (pidIt == idxPidMap_.end()) {
+    SessionPtr sess = sessionTable_.EraseByPid(pid);
+    if (sess == nullptr) {
         SEN_HILOGW("Pid session not exist");
         return;
     }
-    int32_t fd = pidIt->second;
-    idxPidMap_.erase(pidIt);
-    auto fdIt = sessionsMap_.find(fd);
-    if (fdIt != sessionsMap_.end()) {
-        sessionsMap_.erase(fdIt);
-    }
+    sess->SetWritableNotifier(nullptr);
+    sess->ClearOutput();
+    int32_t fd = sess->GetFd();
     if (fd >= 0) {
+        DelReactorFd(fd);
         int32_t ret = fdsan_close_with_tag(fd, TAG);
         if (ret != 0) {
             SEN_HILOGE("Socket fd close failed, ret:%{public}d, errno:%{public}d", ret, errno);
         }
     }
 }
+
+void StreamServer::GetSessionInfo(std::vector<SessionInfo> &sessionInfo)
+{
+    for (const auto &sess : sessionTable_.GetAll()) {
+        if (sess == nullptr) {
+            continue;
+        }
+        SessionInfo info;
+        info.fd = sess->GetFd();
+        info.pid = sess->GetPid();
+        info.uid = sess->GetUid();
+        info.programName = sess->GetProgramName();
+        info.memorySize = sess->GetMemorySize();
+        info.outputSize = sess->GetOutputSize();
+        sessionInfo.push_back(info);
+    }
+}
+
+bool StreamServer::AddDataChannel(const sptr<SensorBasicDataChannel> &channel)
+{
+    CHKPF(channel);
+    int32_t fd = channel->GetSendDataFd();
+    if (fd < 0) {
+        SEN_HILOGE("Fd is invalid");
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> dataChannelLock(dataChannelMutex_);
+        dataChannelMap_[fd] = channel;
+    }
+    if (!AddReactorFd(fd, DATA_CHANNEL_REACTOR_EVENTS)) {
+        SEN_HILOGE("Data channel is not watched by reactor, fd:%{public}d", fd);
+        std::lock_guard<std::mutex> dataChannelLock(dataChannelMutex_);
+        dataChannelMap_.erase(fd);
+        return false;
+    }
+    channel->SetWritableNotifier([this](int32_t channelFd, bool watchWritable) {
+        WatchWritable(channelFd, DATA_CHANNEL_REACTOR_EVENTS, watchWritable);
+    });
+    return true;
+}
+
+void StreamServer::DelDataChannel(const sptr<SensorBasicDataChannel> &channel)
+{
+    CHKPV(channel);
+    channel->SetWritableNotifier(nullptr);
+    channel->ClearPendingData();
+    int32_t fd = channel->GetSendDataFd();
+    if (fd < 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> dataChannelLock(dataChannelMutex_);
+        auto it = dataChannelMap_.find(fd);
+        if ((it != dataChannelMap_.end()) && (it->second == channel)) {
+            dataChannelMap_.erase(it);
+        }
+    }
+    DelReactorFd(fd);
+}
+
+bool StreamServer::StartReactorLocked()
+{
+    if (reactorRunning_) {
+        return true;
+    }
+    if (reactorStopped_) {
+        SEN_HILOGW("Reactor is stopped");
+        return false;
+    }
+    reactorFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (reactorFd_ < 0) {
+        SEN_HILOGE("Create epoll failed, errno:%{public}d", errno);
+        return false;
+    }
+    wakeupFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeupFd_ < 0) {
+        SEN_HILOGE("Create eventfd failed, errno:%{public}d", errno);
+        close(reactorFd_);
+        reactorFd_ = INVALID_FD;
+        return false;
+    }
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = wakeupFd_;
+    if (epoll_ctl(reactorFd_, EPOLL_CTL_ADD, wakeupFd_, &ev) != 0) {
+        SEN_HILOGE("Add wakeup fd failed, errno:%{public}d", errno);
+        close(wakeupFd_);
+        close(reactorFd_);
+        wakeupFd_ = INVALID_FD;
+        reactorFd_ = INVALID_FD;
+        return false;
+    }
+    reactorRunning_ = true;
+    int32_t reactorFd = reactorFd_;
+    int32_t wakeupFd = wakeupFd_;
+    reactorThread_ = std::thread([this, reactorFd, wakeupFd] { ReactorThread(reactorFd, wakeupFd); });
+    return true;
+}
+
+void StreamServer::StartReactor()
+{
+    std::lock_guard<std::mutex> reactorLock(reactorMutex_);
+    reactorStopped_ = false;
+}
+
+void StreamServer::StopReactor()
+{
+    std::thread reactorThread;
+    {
+        std::lock_guard<std::mutex> reactorLock(reactorMutex_);
+        reactorStopped_ = true;
+        if (!reactorRunning_) {
+            return;
+        }
+        reactorRunning_ = false;
+        uint64_t value = 1;
+        if (write(wakeupFd_, &value, sizeof(value)) != sizeof(value)) {
+            SEN_HILOGE("Wakeup reactor failed, errno:%{public}d", errno);
+        }
+        reactorThread.swap(reactorThread_);
+    }
+    // The reactor thread takes reactorMutex_ when it drops a closed fd, so it is joined without holding the lock
+    if (reactorThread.joinable()) {
+        reactorThread.join();
+    }
+    std::lock_guard<std::mutex> reactorLock(reactorMutex_);
+    close(wakeupFd_);
+    close(reactorFd_);
+    wakeupFd_ = INVALID_FD;
+    reactorFd_ = INVALID_FD;
+}
+
+void StreamServer::ReactorThread(int32_t reactorFd, int32_t wakeupFd)
+{
+    prctl(PR_SET_NAME, REACTOR_THREAD_NAME.c_str());
+    struct epoll_event events[MAX_REACTOR_EVENT_SIZE];
+    while (reactorRunning_) {
+        int32_t count = epoll_wait(reactorFd, events, MAX_REACTOR_EVENT_SIZE, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SEN_HILOGE("Epoll wait failed, errno:%{public}d", errno);
+            break;
+        }
+        for (int32_t i = 0; i < count; ++i) {
+            if (events[i].data.fd == wakeupFd) {
+                uint64_t value = 0;
+                if ((read(wakeupFd, &value, sizeof(value)) != sizeof(value)) && (errno != EAGAIN)) {
+                    SEN_HILOGE("Read wakeup fd failed, errno:%{public}d", errno);
+                }
+                continue;
+            }
+            OnReactorEvent(events[i].data.fd, events[i].events);
+        }
+    }
+}
+
+void StreamServer::OnReactorEvent(int32_t fd, uint32_t events)
+{
+    bool peerClosed = ((events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP)) != 0);
+    SessionPtr sess = sessionTable_.FindByFd(fd);
+    if (sess != nullptr) {
+        if (peerClosed) {
+            SEN_HILOGI("Session peer closed, fd:%{public}d, pid:%{public}d", fd, sess->GetPid());
+            sess->ClearOutput();
+            DelReactorFd(fd);
+        } else if ((events & EPOLLOUT) != 0) {
+            sess->FlushOutput();
+        }
+        return;
+    }
+    sptr<SensorBasicDataChannel> channel = nullptr;
+    {
+        std::lock_guard<std::mutex> dataChannelLock(dataChannelMutex_);
+        auto it = dataChannelMap_.find(fd);
+        if (it != dataChannelMap_.end()) {
+            channel = it->second.promote();
+        }
+    }
+    if (channel == nullptr) {
+        std::lock_guard<std::mutex> dataChannelLock(dataChannelMutex_);
+        dataChannelMap_.erase(fd);
+        DelReactorFd(fd);
+        return;
+    }
+    if (peerClosed) {
+        SEN_HILOGI("Data channel peer closed, fd:%{public}d", fd);
+        DelDataChannel(channel);
+        return;
+    }
+    if ((events & EPOLLIN) != 0) {
+        channel->ReceiveCredit();
+    }
+    if ((events & EPOLLOUT) != 0) {
+        channel->FlushPendingData();
+    }
+}
+
+bool StreamServer::AddReactorFd(int32_t fd, uint32_t events)
+{
+    std::lock_guard<std::mutex> reactorLock(reactorMutex_);
+    if (!StartReactorLocked()) {
+        return false;
+    }
+    struct epoll_event ev = {};
+    ev.events = events;
+    ev.data.fd = fd;
+    if (epoll_ctl(reactorFd_, EPOLL_CTL_ADD, fd, &ev) == 0) {
+        return true;
+    }
+    if ((errno == EEXIST) && (epoll_ctl(reactorFd_, EPOLL_CTL_MOD, fd, &ev) == 0)) {
+        return true;
+    }
+    SEN_HILOGE("Add fd to reactor failed, fd:%{public}d, errno:%{public}d", fd, errno);
+    return false;
+}
+
+void StreamServer::DelReactorFd(int32_t fd)
+{
+    std::lock_guard<std::mutex> reactorLock(reactorMutex_);
+    if (!reactorRunning_) {
+        return;
+    }
+    if (epoll_ctl(reactorFd_, EPOLL_CTL_DEL, fd, nullptr) != 0) {
+        SEN_HILOGD("Del fd from reactor failed, fd:%{public}d, errno:%{public}d", fd, errno);
+    }
+}
+
+void StreamServer::WatchWritable(int32_t fd, uint32_t events, bool watchWritable)
+{
+    std::lock_guard<std::mutex> reactorLock(reactorMutex_);
+    if (!reactorRunning_) {
+        return;
+    }
+    struct epoll_event ev = {};
+    ev.events = watchWritable ? (events | EPOLLOUT) : events;
+    ev.data.fd = fd;
+    if (epoll_ctl(reactorFd_, EPOLL_CTL_MOD, fd, &ev) != 0) {
+        SEN_HILOGW("Modify fd in reactor failed, fd:%{public}d, errno:%{public}d", fd, errno);
+    }
+}
 } // namespace Sensors
 } // namespace OHOS
\ No newline at end of file
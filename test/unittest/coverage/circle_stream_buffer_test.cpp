@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "circle_stream_buffer.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CircleStreamBufferTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr size_t REQUEST_CAPACITY = 300;
+constexpr size_t EXPECT_CAPACITY = 512;
+constexpr size_t CHUNK_SIZE = 200;
+constexpr int32_t ROUND_COUNT = 16;
+} // namespace
+
+class CircleStreamBufferTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+HWTEST_F(CircleStreamBufferTest, CircleStreamBufferTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("CircleStreamBufferTest_001 in");
+    CircleStreamBuffer circBuf(REQUEST_CAPACITY);
+    ASSERT_EQ(circBuf.Capacity(), EXPECT_CAPACITY);
+    CircleStreamBuffer defaultBuf;
+    ASSERT_EQ(defaultBuf.Capacity(), DEFAULT_CIRCLE_BUF_SIZE);
+    ASSERT_TRUE(defaultBuf.IsEmpty());
+}
+
+HWTEST_F(CircleStreamBufferTest, CircleStreamBufferTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("CircleStreamBufferTest_002 in");
+    CircleStreamBuffer circBuf(REQUEST_CAPACITY);
+    char input[CHUNK_SIZE] = {};
+    for (size_t i = 0; i < CHUNK_SIZE; ++i) {
+        input[i] = static_cast<char>(i);
+    }
+    for (int32_t round = 0; round < ROUND_COUNT; ++round) {
+        ASSERT_TRUE(circBuf.Write(input, CHUNK_SIZE));
+        ASSERT_TRUE(circBuf.Write(input, CHUNK_SIZE));
+        ASSERT_FALSE(circBuf.CheckWrite(CHUNK_SIZE));
+        for (int32_t chunk = 0; chunk < 2; ++chunk) {
+            char output[CHUNK_SIZE] = {};
+            ASSERT_TRUE(circBuf.Peek(0, output, CHUNK_SIZE));
+            for (size_t i = 0; i < CHUNK_SIZE; ++i) {
+                ASSERT_EQ(output[i], input[i]);
+            }
+            ASSERT_TRUE(circBuf.SeekReadPos(CHUNK_SIZE));
+        }
+        ASSERT_TRUE(circBuf.IsEmpty());
+    }
+}
+
+HWTEST_F(CircleStreamBufferTest, CircleStreamBufferTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("CircleStreamBufferTest_003 in");
+    CircleStreamBuffer circBuf(REQUEST_CAPACITY);
+    char input[CHUNK_SIZE] = {};
+    char output[CHUNK_SIZE] = {};
+    ASSERT_FALSE(circBuf.Write(nullptr, CHUNK_SIZE));
+    ASSERT_FALSE(circBuf.Peek(0, output, CHUNK_SIZE));
+    ASSERT_TRUE(circBuf.Write(input, CHUNK_SIZE));
+    ASSERT_FALSE(circBuf.Peek(1, output, CHUNK_SIZE));
+    ASSERT_FALSE(circBuf.SeekReadPos(CHUNK_SIZE + 1));
+    circBuf.Reset();
+    ASSERT_TRUE(circBuf.IsEmpty());
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <gtest/gtest.h>
+
+#include "cj_sensor_impl.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CJSensorImplTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t SENSOR_TYPE_ID = SENSOR_TYPE_ID_ACCELEROMETER;
+constexpr int32_t MAX_BATCH_SIZE = 3;
+constexpr int64_t LONG_REPORT_INTERVAL_NS = 10000000000;
+constexpr int64_t SHORT_REPORT_INTERVAL_NS = 20000000;
+constexpr int64_t SAMPLE_STEP_NS = 1000000;
+constexpr int32_t FLUSH_WAIT_MS = 1000;
+} // namespace
+
+class CJSensorImplTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown();
+    void Subscribe(int64_t reportInterval, int32_t maxBatchSize, bool latestOnly);
+    void Emit(int64_t timestamp, float value);
+
+    std::mutex mutex_;
+    std::condition_variable flushCv_;
+    std::vector<std::vector<std::pair<int64_t, float>>> flushes_;
+};
+
+void CJSensorImplTest::TearDown()
+{
+    CJ_SENSOR_IMPL->DelCallback(SENSOR_TYPE_ID);
+}
+
+void CJSensorImplTest::Subscribe(int64_t reportInterval, int32_t maxBatchSize, bool latestOnly)
+{
+    CSensorBatchOptions options = { .reportInterval = reportInterval, .maxBatchSize = maxBatchSize,
+        .latestOnly = latestOnly };
+    auto batch = CJ_SENSOR_IMPL->CreateBatch(options, [this](CSensorEventArray events) {
+        std::vector<std::pair<int64_t, float>> flush;
+        for (int64_t i = 0; i < events.size; ++i) {
+            flush.emplace_back(events.head[i].timestamp, *reinterpret_cast<float *>(events.head[i].data));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        flushes_.push_back(std::move(flush));
+        flushCv_.notify_all();
+    });
+    CJ_SENSOR_IMPL->AddBatch2Map(SENSOR_TYPE_ID, batch);
+}
+
+void CJSensorImplTest::Emit(int64_t timestamp, float value)
+{
+    SensorEvent event {};
+    event.sensorTypeId = SENSOR_TYPE_ID;
+    event.timestamp = timestamp;
+    event.data = reinterpret_cast<uint8_t *>(&value);
+    event.dataLen = sizeof(value);
+    CJ_SENSOR_IMPL->EmitCallBack(&event);
+}
+
+HWTEST_F(CJSensorImplTest, CJSensorImplTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("CJSensorImplTest_001 in");
+    Subscribe(LONG_REPORT_INTERVAL_NS, MAX_BATCH_SIZE, false);
+    for (int32_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+        Emit(i * SAMPLE_STEP_NS, static_cast<float>(i));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(flushes_.size(), 1U);
+    ASSERT_EQ(flushes_[0].size(), static_cast<size_t>(MAX_BATCH_SIZE));
+    for (int32_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+        EXPECT_EQ(flushes_[0][i].first, i * SAMPLE_STEP_NS);
+        EXPECT_EQ(flushes_[0][i].second, static_cast<float>(i));
+    }
+}
+
+HWTEST_F(CJSensorImplTest, CJSensorImplTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("CJSensorImplTest_002 in");
+    Subscribe(LONG_REPORT_INTERVAL_NS, MAX_BATCH_SIZE, true);
+    for (int32_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+        Emit(i * SAMPLE_STEP_NS, static_cast<float>(i));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ASSERT_TRUE(flushes_.empty());
+    }
+    Emit(LONG_REPORT_INTERVAL_NS, static_cast<float>(MAX_BATCH_SIZE));
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(flushes_.size(), 1U);
+    ASSERT_EQ(flushes_[0].size(), 1U);
+    EXPECT_EQ(flushes_[0][0].first, LONG_REPORT_INTERVAL_NS);
+    EXPECT_EQ(flushes_[0][0].second, static_cast<float>(MAX_BATCH_SIZE));
+}
+
+HWTEST_F(CJSensorImplTest, CJSensorImplTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("CJSensorImplTest_003 in");
+    Subscribe(SHORT_REPORT_INTERVAL_NS, MAX_BATCH_SIZE, false);
+    Emit(0, 1.0f);
+    std::unique_lock<std::mutex> lock(mutex_);
+    ASSERT_TRUE(flushCv_.wait_for(lock, std::chrono::milliseconds(FLUSH_WAIT_MS), [this] {
+        return !flushes_.empty();
+    }));
+    ASSERT_EQ(flushes_.size(), 1U);
+    ASSERT_EQ(flushes_[0].size(), 1U);
+    EXPECT_EQ(flushes_[0][0].second, 1.0f);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "securec.h"
+
+#include "compact_sensor_event.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CompactSensorEventTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t ACCEL_TYPE_ID = 1;
+constexpr int32_t GYRO_TYPE_ID = 2;
+constexpr uint32_t ACCEL_DATA_LEN = 12;
+constexpr int64_t BASE_TIMESTAMP = 1000000000;
+constexpr int64_t SAMPLING_PERIOD_NS = 1000000;
+constexpr size_t EVENT_COUNT = 10;
+constexpr uint64_t LOST_COUNT = 3;
+} // namespace
+
+class CompactSensorEventTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+    SensorData MakeEvent(int32_t sensorTypeId, int64_t timestamp);
+};
+
+SensorData CompactSensorEventTest::MakeEvent(int32_t sensorTypeId, int64_t timestamp)
+{
+    SensorData event;
+    (void)memset_s(&event, sizeof(event), 0, sizeof(event));
+    event.sensorTypeId = sensorTypeId;
+    event.sensorId = sensorTypeId;
+    event.timestamp = timestamp;
+    event.dataLen = ACCEL_DATA_LEN;
+    return event;
+}
+
+HWTEST_F(CompactSensorEventTest, CompactSensorEventTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("CompactSensorEventTest_001 in");
+    SensorData events[EVENT_COUNT];
+    for (size_t i = 0; i < EVENT_COUNT; ++i) {
+        events[i] = MakeEvent(ACCEL_TYPE_ID, BASE_TIMESTAMP + static_cast<int64_t>(i) * SAMPLING_PERIOD_NS);
+    }
+    SensorEventEncoder encoder;
+    std::vector<char> buf;
+    encoder.Encode(events, EVENT_COUNT, buf);
+    size_t eventSize = sizeof(CompactEventRecord) + ACCEL_DATA_LEN;
+    ASSERT_EQ(buf.size(), sizeof(CompactSensorRecord) + EVENT_COUNT * eventSize);
+    ASSERT_LT(buf.size(), EVENT_COUNT * sizeof(SensorData));
+    CompactSensorRecord sensor;
+    ASSERT_EQ(memcpy_s(&sensor, sizeof(sensor), buf.data(), sizeof(sensor)), EOK);
+    ASSERT_EQ(sensor.type, COMPACT_RECORD_SENSOR);
+    ASSERT_EQ(sensor.sensorTypeId, ACCEL_TYPE_ID);
+    ASSERT_EQ(sensor.timestamp, BASE_TIMESTAMP);
+    CompactEventRecord event;
+    ASSERT_EQ(memcpy_s(&event, sizeof(event), buf.data() + sizeof(sensor) + eventSize, sizeof(event)), EOK);
+    ASSERT_EQ(event.type, COMPACT_RECORD_EVENT);
+    ASSERT_EQ(event.handle, sensor.handle);
+    ASSERT_EQ(event.dataLen, ACCEL_DATA_LEN);
+    ASSERT_EQ(event.timestampDelta, static_cast<uint32_t>(SAMPLING_PERIOD_NS));
+}
+
+HWTEST_F(CompactSensorEventTest, CompactSensorEventTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("CompactSensorEventTest_002 in");
+    SensorEventEncoder encoder;
+    std::vector<char> buf;
+    SensorData accel = MakeEvent(ACCEL_TYPE_ID, BASE_TIMESTAMP);
+    encoder.Encode(&accel, 1, buf);
+    size_t eventSize = sizeof(CompactEventRecord) + ACCEL_DATA_LEN;
+    ASSERT_EQ(buf.size(), sizeof(CompactSensorRecord) + eventSize);
+    accel.timestamp += SAMPLING_PERIOD_NS;
+    encoder.Encode(&accel, 1, buf);
+    ASSERT_EQ(buf.size(), eventSize);
+    SensorData gyro = MakeEvent(GYRO_TYPE_ID, BASE_TIMESTAMP);
+    encoder.Encode(&gyro, 1, buf);
+    ASSERT_EQ(buf.size(), sizeof(CompactSensorRecord) + eventSize);
+    accel.option = 1;
+    encoder.Encode(&accel, 1, buf);
+    ASSERT_EQ(buf.size(), sizeof(CompactSensorRecord) + eventSize);
+    accel.timestamp -= SAMPLING_PERIOD_NS;
+    encoder.Encode(&accel, 1, buf);
+    ASSERT_EQ(buf.size(), sizeof(CompactSensorRecord) + eventSize);
+    encoder.Reset();
+    encoder.Encode(&gyro, 1, buf);
+    ASSERT_EQ(buf.size(), sizeof(CompactSensorRecord) + eventSize);
+}
+
+HWTEST_F(CompactSensorEventTest, CompactSensorEventTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("CompactSensorEventTest_003 in");
+    SensorEventEncoder encoder;
+    std::vector<char> buf;
+    SensorData accel = MakeEvent(ACCEL_TYPE_ID, BASE_TIMESTAMP);
+    encoder.SetLostCount(LOST_COUNT);
+    encoder.Encode(&accel, 1, buf);
+    size_t eventSize = sizeof(CompactEventRecord) + ACCEL_DATA_LEN;
+    ASSERT_EQ(buf.size(), sizeof(CompactGapRecord) + sizeof(CompactSensorRecord) + eventSize);
+    CompactGapRecord gap;
+    ASSERT_EQ(memcpy_s(&gap, sizeof(gap), buf.data(), sizeof(gap)), EOK);
+    ASSERT_EQ(gap.type, COMPACT_RECORD_GAP);
+    ASSERT_EQ(gap.lostCount, LOST_COUNT);
+    accel.timestamp += SAMPLING_PERIOD_NS;
+    encoder.Encode(&accel, 1, buf);
+    ASSERT_EQ(buf.size(), eventSize);
+}
+} // namespace Sensors
+} // namespace OHOS
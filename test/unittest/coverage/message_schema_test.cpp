@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "message_schema.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "MessageSchemaTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t PID = 1000;
+constexpr int32_t SENSOR_ID = 1;
+constexpr int64_t SAMPLING_PERIOD_NS = 200000000;
+constexpr int64_t MAX_REPORT_DELAY_NS = 0;
+constexpr int32_t EXTRA_FIELD = 7;
+constexpr size_t MAX_COUNT = 8;
+
+#pragma pack(1)
+struct ActiveInfoRecordV2 {
+    ActiveInfoRecord base;
+    int32_t extra { EXTRA_FIELD };
+};
+#pragma pack()
+} // namespace
+
+class MessageSchemaTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+HWTEST_F(MessageSchemaTest, MessageSchemaTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("MessageSchemaTest_001 in");
+    ActiveInfoRecord input[MAX_COUNT];
+    for (size_t i = 0; i < MAX_COUNT; ++i) {
+        input[i] = { PID + static_cast<int32_t>(i), SENSOR_ID, SAMPLING_PERIOD_NS, MAX_REPORT_DELAY_NS };
+    }
+    NetPacket pkt(MessageId::ACTIVE_INFO);
+    ASSERT_TRUE(EncodeMessage(pkt, input, MAX_COUNT));
+    ActiveInfoRecord output[MAX_COUNT];
+    size_t count = 0;
+    ASSERT_TRUE(DecodeMessage(pkt, output, MAX_COUNT, count));
+    ASSERT_EQ(count, MAX_COUNT);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(output[i].pid, PID + static_cast<int32_t>(i));
+        ASSERT_EQ(output[i].sensorId, SENSOR_ID);
+        ASSERT_EQ(output[i].samplingPeriodNs, SAMPLING_PERIOD_NS);
+        ASSERT_EQ(output[i].maxReportDelayNs, MAX_REPORT_DELAY_NS);
+    }
+}
+
+HWTEST_F(MessageSchemaTest, MessageSchemaTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("MessageSchemaTest_002 in");
+    ActiveInfoRecordV2 input;
+    input.base = { PID, SENSOR_ID, SAMPLING_PERIOD_NS, MAX_REPORT_DELAY_NS };
+    NetPacket pkt(MessageId::ACTIVE_INFO);
+    ASSERT_TRUE(EncodeMessage(pkt, &input, 1));
+    ActiveInfoRecord output;
+    size_t count = 0;
+    ASSERT_TRUE(DecodeMessage(pkt, &output, 1, count));
+    ASSERT_EQ(count, 1U);
+    ASSERT_EQ(output.pid, PID);
+    ASSERT_EQ(output.maxReportDelayNs, MAX_REPORT_DELAY_NS);
+
+    ActiveInfoRecord older = { PID, SENSOR_ID, SAMPLING_PERIOD_NS, MAX_REPORT_DELAY_NS };
+    pkt.Reset(MessageId::ACTIVE_INFO);
+    ASSERT_TRUE(EncodeMessage(pkt, &older, 1));
+    ActiveInfoRecordV2 newer;
+    newer.extra = 0;
+    ASSERT_TRUE(DecodeMessage(pkt, &newer, 1, count));
+    ASSERT_EQ(count, 1U);
+    ASSERT_EQ(newer.base.sensorId, SENSOR_ID);
+    ASSERT_EQ(newer.extra, EXTRA_FIELD);
+}
+
+HWTEST_F(MessageSchemaTest, MessageSchemaTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("MessageSchemaTest_003 in");
+    ActiveInfoRecord input[MAX_COUNT];
+    NetPacket pkt(MessageId::ACTIVE_INFO);
+    ASSERT_TRUE(EncodeMessage(pkt, input, MAX_COUNT));
+    ActiveInfoRecord output[MAX_COUNT];
+    size_t count = 0;
+    ASSERT_FALSE(DecodeMessage(pkt, output, MAX_COUNT - 1, count));
+
+    NetPacket truncated(MessageId::ACTIVE_INFO);
+    MessageHeader head;
+    head.recordSize = sizeof(ActiveInfoRecord);
+    head.recordCount = 1;
+    ASSERT_TRUE(truncated.Write(head));
+    ASSERT_FALSE(DecodeMessage(truncated, output, MAX_COUNT, count));
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "accesstoken_kit.h"
+
+#include "permission_util.h"
+#include "sensor_agent_type.h"
+#include "sensor_errors.h"
+#include "sensor_service.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PermissionUtilTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+using namespace Security::AccessToken;
+
+namespace {
+constexpr int32_t TEST_PID = 100000;
+constexpr int32_t TEST_UID = 100000;
+
+PermissionStateFull g_infoManagerTestState = {
+    .grantFlags = {1},
+    .grantStatus = {PermissionState::PERMISSION_GRANTED},
+    .isGeneral = true,
+    .permissionName = "ohos.permission.ACCELEROMETER",
+    .resDeviceID = {"local"}
+};
+
+HapPolicyParams g_infoManagerTestPolicyPrams = {
+    .apl = APL_NORMAL,
+    .domain = "test.domain",
+    .permList = {},
+    .permStateList = {g_infoManagerTestState}
+};
+
+HapInfoParams g_infoManagerTestInfoParms = {
+    .bundleName = "permissionutil_test",
+    .userID = 1,
+    .instIndex = 0,
+    .appIDDesc = "permissionUtilTest"
+};
+} // namespace
+
+class PermissionUtilTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() {}
+    void TearDown();
+    static bool IsCached(AccessTokenID tokenId, const std::string &permissionName);
+    static void SetCached(AccessTokenID tokenId, const std::string &permissionName, int32_t result);
+
+    static AccessTokenID tokenID_;
+};
+
+AccessTokenID PermissionUtilTest::tokenID_ = 0;
+
+void PermissionUtilTest::SetUpTestCase()
+{
+    AccessTokenIDEx tokenIdEx = AccessTokenKit::AllocHapToken(g_infoManagerTestInfoParms,
+        g_infoManagerTestPolicyPrams);
+    tokenID_ = tokenIdEx.tokenIdExStruct.tokenID;
+    ASSERT_NE(0, tokenID_);
+}
+
+void PermissionUtilTest::TearDownTestCase()
+{
+    if (tokenID_ != 0) {
+        ASSERT_EQ(RET_SUCCESS, AccessTokenKit::DeleteToken(tokenID_));
+    }
+}
+
+void PermissionUtilTest::TearDown()
+{
+    PermissionUtil::GetInstance().InvalidateToken(tokenID_);
+}
+
+bool PermissionUtilTest::IsCached(AccessTokenID tokenId, const std::string &permissionName)
+{
+    PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
+    std::lock_guard<std::mutex> permCacheLock(permissionUtil.permCacheMutex_);
+    auto tokenIt = permissionUtil.permCache_.find(tokenId);
+    return (tokenIt != permissionUtil.permCache_.end()) &&
+        (tokenIt->second.find(permissionName) != tokenIt->second.end());
+}
+
+void PermissionUtilTest::SetCached(AccessTokenID tokenId, const std::string &permissionName, int32_t result)
+{
+    PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
+    std::lock_guard<std::mutex> permCacheLock(permissionUtil.permCacheMutex_);
+    permissionUtil.permCache_[tokenId][permissionName] = result;
+}
+
+HWTEST_F(PermissionUtilTest, PermissionUtilTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("PermissionUtilTest_001 in");
+    PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
+    ASSERT_EQ(permissionUtil.CheckSensorPermission(tokenID_, SENSOR_TYPE_ID_ACCELEROMETER), PERMISSION_GRANTED);
+    ASSERT_TRUE(IsCached(tokenID_, ACCELEROMETER_PERMISSION));
+    SetCached(tokenID_, ACCELEROMETER_PERMISSION, PERMISSION_DENIED);
+    ASSERT_EQ(permissionUtil.CheckSensorPermission(tokenID_, SENSOR_TYPE_ID_ACCELEROMETER), PERMISSION_DENIED);
+}
+
+HWTEST_F(PermissionUtilTest, PermissionUtilTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("PermissionUtilTest_002 in");
+    PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
+    SetCached(tokenID_, ACCELEROMETER_PERMISSION, PERMISSION_DENIED);
+    permissionUtil.InvalidateToken(tokenID_);
+    ASSERT_FALSE(IsCached(tokenID_, ACCELEROMETER_PERMISSION));
+    ASSERT_EQ(permissionUtil.CheckSensorPermission(tokenID_, SENSOR_TYPE_ID_ACCELEROMETER), PERMISSION_GRANTED);
+    ASSERT_TRUE(IsCached(tokenID_, ACCELEROMETER_PERMISSION));
+}
+
+HWTEST_F(PermissionUtilTest, PermissionUtilTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("PermissionUtilTest_003 in");
+    auto service = SensorDelayedSpSingleton<SensorService>::GetInstance();
+    ASSERT_NE(service, nullptr);
+    ASSERT_TRUE(service->clientInfo_.UpdateAppThreadInfo(TEST_PID, TEST_UID, tokenID_));
+    ASSERT_EQ(PermissionUtil::GetInstance().CheckSensorPermission(tokenID_, SENSOR_TYPE_ID_ACCELEROMETER),
+        PERMISSION_GRANTED);
+    ASSERT_TRUE(IsCached(tokenID_, ACCELEROMETER_PERMISSION));
+    service->TeardownClient(TEST_PID, nullptr);
+    ASSERT_FALSE(IsCached(tokenID_, ACCELEROMETER_PERMISSION));
+    service->clientInfo_.DestroyAppThreadInfo(TEST_PID);
+}
+} // namespace Sensors
+} // namespace OHOS
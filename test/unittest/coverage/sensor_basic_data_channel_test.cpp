@@ -15,6 +15,7 @@
 
 #include <cinttypes>
 #include <memory>
+#include <vector>
 #include <gtest/gtest.h>
 #include <sys/socket.h>
 
@@ -34,6 +35,8 @@ using namespace OHOS::HiviewDFX;
 namespace {
 constexpr int32_t INVALID_FD = -2;
 constexpr int32_t VALID_FD = 1;
+constexpr int32_t MAX_SEND_COUNT = 10000;
+constexpr int32_t MAX_PENDING_EVENT_COUNT = 1024;
 } // namespace
 
 class SensorBasicDataChannelTest : public testing::Test {
@@ -133,6 +136,148 @@ HWTEST_F(SensorBasicDataChannelTest, SendData_002, TestSize.Level1)
     ASSERT_EQ(ret, SENSOR_CHANNEL_SEND_ADDR_ERR);
 }
 
+HWTEST_F(SensorBasicDataChannelTest, SendData_003, TestSize.Level1)
+{
+    SEN_HILOGI("SendData_003 in");
+    SensorBasicDataChannel sensorChannel = SensorBasicDataChannel();
+    int32_t ret = sensorChannel.CreateSensorBasicChannel();
+    ASSERT_EQ(ret, ERR_OK);
+    int32_t watchCount = 0;
+    int32_t unwatchCount = 0;
+    sensorChannel.SetWritableNotifier([&watchCount, &unwatchCount] (int32_t fd, bool watchWritable) {
+        watchWritable ? ++watchCount : ++unwatchCount;
+    });
+    SensorData sensorData;
+    for (int32_t i = 0; (i < MAX_SEND_COUNT) && (sensorChannel.GetPendingSize() == 0); ++i) {
+        ret = sensorChannel.SendData(static_cast<void *>(&sensorData), sizeof(sensorData));
+        ASSERT_EQ(ret, ERR_OK);
+    }
+    ASSERT_GT(sensorChannel.GetPendingSize(), 0U);
+    ASSERT_EQ(watchCount, 1);
+    for (int32_t i = 0; (i < MAX_SEND_COUNT) && (sensorChannel.GetPendingSize() > 0); ++i) {
+        while (recv(sensorChannel.GetReceiveDataFd(), &sensorData, sizeof(sensorData), MSG_DONTWAIT) > 0) {}
+        sensorChannel.FlushPendingData();
+    }
+    ASSERT_EQ(sensorChannel.GetPendingSize(), 0U);
+    ASSERT_EQ(unwatchCount, 1);
+}
+
+HWTEST_F(SensorBasicDataChannelTest, SendData_004, TestSize.Level1)
+{
+    SEN_HILOGI("SendData_004 in");
+    SensorBasicDataChannel sensorChannel = SensorBasicDataChannel();
+    int32_t ret = sensorChannel.CreateSensorBasicChannel();
+    ASSERT_EQ(ret, ERR_OK);
+    int32_t watchCount = 0;
+    sensorChannel.SetWritableNotifier([&watchCount] (int32_t fd, bool watchWritable) {
+        watchCount += watchWritable ? 1 : 0;
+    });
+    ret = sensorChannel.GrantCredit(2);
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.ReceiveCredit();
+    SensorData sensorData;
+    for (int32_t i = 0; i < 3; ++i) {
+        ret = sensorChannel.SendData(static_cast<void *>(&sensorData), sizeof(sensorData));
+        ASSERT_EQ(ret, ERR_OK);
+    }
+    ASSERT_EQ(sensorChannel.GetPendingSize(), 1U);
+    ASSERT_EQ(watchCount, 0);
+    ret = sensorChannel.GrantCredit(1);
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.ReceiveCredit();
+    ASSERT_EQ(sensorChannel.GetPendingSize(), 0U);
+    ASSERT_EQ(sensorChannel.GetLostEventCount(), 0U);
+}
+
+HWTEST_F(SensorBasicDataChannelTest, SendData_005, TestSize.Level1)
+{
+    SEN_HILOGI("SendData_005 in");
+    SensorBasicDataChannel sensorChannel = SensorBasicDataChannel();
+    int32_t ret = sensorChannel.CreateSensorBasicChannel();
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.SetWritableNotifier([] (int32_t fd, bool watchWritable) {});
+    ret = sensorChannel.GrantCredit(0);
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.ReceiveCredit();
+    SensorData sensorData;
+    for (int32_t i = 0; i <= MAX_PENDING_EVENT_COUNT; ++i) {
+        ret = sensorChannel.SendData(static_cast<void *>(&sensorData), sizeof(sensorData));
+        ASSERT_EQ(ret, ERR_OK);
+    }
+    ASSERT_EQ(sensorChannel.GetLostEventCount(), 1U);
+    ret = sensorChannel.GrantCredit(1);
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.ReceiveCredit();
+    char buff[sizeof(SensorData)] = {};
+    ASSERT_GT(recv(sensorChannel.GetReceiveDataFd(), buff, sizeof(buff), MSG_DONTWAIT), 0);
+    ASSERT_EQ(static_cast<uint8_t>(buff[0]), COMPACT_RECORD_GAP);
+}
+
+HWTEST_F(SensorBasicDataChannelTest, SendData_006, TestSize.Level1)
+{
+    SEN_HILOGI("SendData_006 in");
+    SensorBasicDataChannel sensorChannel = SensorBasicDataChannel();
+    int32_t ret = sensorChannel.CreateSensorBasicChannel();
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.SetWritableNotifier([] (int32_t fd, bool watchWritable) {});
+    ret = sensorChannel.GrantCredit(0);
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.ReceiveCredit();
+    constexpr int32_t overflowCount = 10;
+    std::vector<SensorData> events(MAX_PENDING_EVENT_COUNT + overflowCount);
+    ret = sensorChannel.SendData(static_cast<void *>(events.data()), events.size() * sizeof(SensorData));
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_EQ(sensorChannel.GetPendingSize(), 1U);
+    ASSERT_EQ(sensorChannel.GetLostEventCount(), static_cast<uint64_t>(overflowCount));
+    sensorChannel.ClearPendingData();
+    ASSERT_EQ(sensorChannel.GetPendingSize(), 0U);
+    ASSERT_EQ(sensorChannel.GetLostEventCount(), events.size());
+}
+
+HWTEST_F(SensorBasicDataChannelTest, SendData_007, TestSize.Level1)
+{
+    SEN_HILOGI("SendData_007 in");
+    SensorBasicDataChannel sensorChannel = SensorBasicDataChannel();
+    int32_t ret = sensorChannel.CreateSensorBasicChannel();
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.SetWritableNotifier([] (int32_t fd, bool watchWritable) {});
+    ret = sensorChannel.GrantCredit(0);
+    ASSERT_EQ(ret, ERR_OK);
+    sensorChannel.ReceiveCredit();
+    constexpr int32_t pendingCount = 3;
+    SensorData sensorData;
+    for (int32_t i = 0; i < pendingCount; ++i) {
+        ret = sensorChannel.SendData(static_cast<void *>(&sensorData), sizeof(sensorData));
+        ASSERT_EQ(ret, ERR_OK);
+    }
+    ret = sensorChannel.GrantCredit(pendingCount);
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_EQ(shutdown(sensorChannel.GetReceiveDataFd(), SHUT_RDWR), 0);
+    sensorChannel.ReceiveCredit();
+    ASSERT_EQ(sensorChannel.GetPendingSize(), 0U);
+    ASSERT_EQ(sensorChannel.GetLostEventCount(), static_cast<uint64_t>(pendingCount));
+}
+
+HWTEST_F(SensorBasicDataChannelTest, SetSendBufferSize_001, TestSize.Level1)
+{
+    SEN_HILOGI("SetSendBufferSize_001 in");
+    SensorBasicDataChannel sensorChannel = SensorBasicDataChannel();
+    int32_t ret = sensorChannel.SetSendBufferSize(sizeof(SensorData) * 200);
+    ASSERT_NE(ret, ERR_OK);
+
+    ret = sensorChannel.CreateSensorBasicChannel();
+    ASSERT_EQ(ret, ERR_OK);
+    ret = sensorChannel.SetSendBufferSize(sizeof(SensorData) * 200);
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_EQ(sensorChannel.GetSendBufferSize(), static_cast<int32_t>(sizeof(SensorData) * 200));
+    ret = sensorChannel.SetSendBufferSize(1);
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_GT(sensorChannel.GetSendBufferSize(), 1);
+    ret = sensorChannel.SetSendBufferSize(INT32_MAX);
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_LT(sensorChannel.GetSendBufferSize(), INT32_MAX);
+}
+
 HWTEST_F(SensorBasicDataChannelTest, ReceiveData_001, TestSize.Level1)
 {
     SEN_HILOGI("ReceiveData_001 in");
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "sensor_catalog.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorCatalogTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr uint64_t GENERATION = 3;
+constexpr int32_t SENSOR_TYPE_ID = 1;
+constexpr int64_t MIN_SAMPLE_PERIOD_NS = 5000000;
+constexpr char SENSOR_NAME[] = "accelerometer";
+constexpr char CACHE_PATH[] = "/data/local/tmp/sensor_list_cache";
+} // namespace
+
+class SensorCatalogTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+HWTEST_F(SensorCatalogTest, SensorCatalogTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorCatalogTest_001 in");
+    Sensor sensor;
+    sensor.SetSensorTypeId(SENSOR_TYPE_ID);
+    sensor.SetSensorName(SENSOR_NAME);
+    sensor.SetMinSamplePeriodNs(MIN_SAMPLE_PERIOD_NS);
+    std::vector<Sensor> sensors = { sensor };
+    SensorCatalogView writer;
+    int32_t fd = SensorCatalog::Publish(sensors, GENERATION, writer);
+    ASSERT_GE(fd, 0);
+    ASSERT_LT(write(fd, SENSOR_NAME, sizeof(SENSOR_NAME)), 0);
+
+    std::vector<Sensor> loadSensors;
+    uint64_t generation = 0;
+    int32_t ret = SensorCatalog::Load(fd, loadSensors, generation);
+    close(fd);
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_EQ(generation, GENERATION);
+    ASSERT_EQ(loadSensors.size(), sensors.size());
+    ASSERT_EQ(loadSensors[0].GetSensorTypeId(), SENSOR_TYPE_ID);
+    ASSERT_EQ(loadSensors[0].GetSensorName(), SENSOR_NAME);
+    ASSERT_EQ(loadSensors[0].GetMinSamplePeriodNs(), MIN_SAMPLE_PERIOD_NS);
+}
+
+HWTEST_F(SensorCatalogTest, SensorCatalogTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SensorCatalogTest_002 in");
+    std::vector<Sensor> sensors;
+    uint64_t generation = 0;
+    ASSERT_NE(SensorCatalog::Load(-1, sensors, generation), ERR_OK);
+}
+
+HWTEST_F(SensorCatalogTest, SensorCatalogTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("SensorCatalogTest_003 in");
+    Sensor sensor;
+    sensor.SetSensorTypeId(SENSOR_TYPE_ID);
+    sensor.SetSensorName(SENSOR_NAME);
+    sensor.SetMinSamplePeriodNs(MIN_SAMPLE_PERIOD_NS);
+    std::vector<Sensor> sensors = { sensor };
+    ASSERT_EQ(SensorCatalog::Save(CACHE_PATH, sensors), ERR_OK);
+    ASSERT_EQ(SensorCatalog::Save(CACHE_PATH, sensors), ERR_OK);
+
+    std::vector<Sensor> restoreSensors;
+    int32_t ret = SensorCatalog::Restore(CACHE_PATH, restoreSensors);
+    unlink(CACHE_PATH);
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_EQ(restoreSensors.size(), sensors.size());
+    ASSERT_EQ(restoreSensors[0].GetSensorTypeId(), SENSOR_TYPE_ID);
+    ASSERT_EQ(restoreSensors[0].GetSensorName(), SENSOR_NAME);
+    ASSERT_NE(SensorCatalog::Restore(CACHE_PATH, restoreSensors), ERR_OK);
+}
+
+HWTEST_F(SensorCatalogTest, SensorCatalogTest_004, TestSize.Level1)
+{
+    SEN_HILOGI("SensorCatalogTest_004 in");
+    Sensor sensor;
+    sensor.SetSensorTypeId(SENSOR_TYPE_ID);
+    sensor.SetSensorName(SENSOR_NAME);
+    std::vector<Sensor> sensors = { sensor };
+    std::vector<Sensor> sameSensors = { sensor };
+    ASSERT_TRUE(SensorCatalog::IsSameList(sensors, sameSensors));
+    sameSensors[0].SetMinSamplePeriodNs(MIN_SAMPLE_PERIOD_NS);
+    ASSERT_FALSE(SensorCatalog::IsSameList(sensors, sameSensors));
+    ASSERT_FALSE(SensorCatalog::IsSameList(sensors, {}));
+}
+
+HWTEST_F(SensorCatalogTest, SensorCatalogTest_005, TestSize.Level1)
+{
+    SEN_HILOGI("SensorCatalogTest_005 in");
+    Sensor sensor;
+    sensor.SetSensorTypeId(SENSOR_TYPE_ID);
+    std::vector<Sensor> sensors = { sensor };
+    SensorCatalogView writer;
+    int32_t fd = SensorCatalog::Publish(sensors, GENERATION, writer);
+    ASSERT_GE(fd, 0);
+    SensorCatalogView reader;
+    int32_t ret = reader.Map(fd);
+    close(fd);
+    ASSERT_EQ(ret, ERR_OK);
+    ASSERT_FALSE(reader.IsStale());
+    writer.MarkStale();
+    writer.Unmap();
+    ASSERT_TRUE(reader.IsStale());
+    std::vector<Sensor> loadSensors;
+    uint64_t generation = 0;
+    ASSERT_EQ(reader.Decode(loadSensors, generation), ERR_OK);
+    ASSERT_EQ(generation, GENERATION);
+    ASSERT_EQ(loadSensors.size(), sensors.size());
+}
+} // namespace Sensors
+} // namespace OHOS
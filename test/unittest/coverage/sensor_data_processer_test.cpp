@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+
+#include "securec.h"
+
+#include "client_info.h"
+#include "compact_sensor_event.h"
+#include "sensor_data_processer.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorDataProcesserTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t TEST_PID = 100000;
+constexpr int32_t TEST_SENSOR_TYPE_ID = 10;
+constexpr int64_t SAMPLING_PERIOD_NS = 200000000;
+constexpr int64_t COALESCE_WINDOW_NS = 5000000000;
+constexpr int64_t BASE_TIMESTAMP = 1000000000;
+constexpr int32_t EVENT_COUNT = 5;
+constexpr size_t RECEIVE_BUFFER_SIZE = 4096;
+const SensorDescription TEST_SENSOR_DESC = { 0, TEST_SENSOR_TYPE_ID, 0, 0 };
+} // namespace
+
+class SensorDataProcesserTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp();
+    void TearDown();
+    int32_t SendChangedEvents(int32_t count);
+    int32_t CountReceivedEvents();
+
+    sptr<SensorBasicDataChannel> channel_ = nullptr;
+    sptr<SensorDataProcesser> processer_ = nullptr;
+};
+
+void SensorDataProcesserTest::SetUp()
+{
+    channel_ = new (std::nothrow) SensorBasicDataChannel();
+    ASSERT_NE(channel_, nullptr);
+    ASSERT_EQ(channel_->CreateSensorBasicChannel(), ERR_OK);
+    Sensor sensor;
+    sensor.SetDeviceId(TEST_SENSOR_DESC.deviceId);
+    sensor.SetSensorTypeId(TEST_SENSOR_DESC.sensorType);
+    sensor.SetSensorId(TEST_SENSOR_DESC.sensorId);
+    sensor.SetLocation(TEST_SENSOR_DESC.location);
+    std::unordered_map<SensorDescription, Sensor> sensorMap = { { TEST_SENSOR_DESC, sensor } };
+    processer_ = new (std::nothrow) SensorDataProcesser(sensorMap);
+    ASSERT_NE(processer_, nullptr);
+    ClientInfo &clientInfo = ClientInfo::GetInstance();
+    ASSERT_TRUE(clientInfo.UpdateSensorChannel(TEST_PID, channel_));
+    SensorBasicInfo sensorInfo;
+    sensorInfo.SetSamplingPeriodNs(SAMPLING_PERIOD_NS);
+    sensorInfo.SetMaxReportDelayNs(SAMPLING_PERIOD_NS);
+    sensorInfo.SetSensorState(true);
+    ASSERT_TRUE(clientInfo.UpdateSensorInfo(TEST_SENSOR_DESC, TEST_PID, sensorInfo));
+}
+
+void SensorDataProcesserTest::TearDown()
+{
+    ClientInfo &clientInfo = ClientInfo::GetInstance();
+    clientInfo.ClearCurPidSensorInfo(TEST_SENSOR_DESC, TEST_PID);
+    clientInfo.DestroySensorChannel(TEST_PID);
+    if (channel_ != nullptr) {
+        channel_->DestroySensorBasicChannel();
+    }
+    processer_ = nullptr;
+    channel_ = nullptr;
+}
+
+int32_t SensorDataProcesserTest::SendChangedEvents(int32_t count)
+{
+    for (int32_t i = 0; i < count; ++i) {
+        SensorData data;
+        (void)memset_s(&data, sizeof(data), 0, sizeof(data));
+        data.deviceId = TEST_SENSOR_DESC.deviceId;
+        data.sensorTypeId = TEST_SENSOR_DESC.sensorType;
+        data.sensorId = TEST_SENSOR_DESC.sensorId;
+        data.location = TEST_SENSOR_DESC.location;
+        data.mode = SENSOR_ON_CHANGE;
+        data.timestamp = BASE_TIMESTAMP + i * SAMPLING_PERIOD_NS;
+        int32_t ret = processer_->SendEvents(channel_, data);
+        if (ret != SUCCESS) {
+            return ret;
+        }
+    }
+    return SUCCESS;
+}
+
+int32_t SensorDataProcesserTest::CountReceivedEvents()
+{
+    char buf[RECEIVE_BUFFER_SIZE] = { 0 };
+    ssize_t length = recv(channel_->GetReceiveDataFd(), buf, sizeof(buf), MSG_DONTWAIT);
+    if (length <= 0) {
+        return 0;
+    }
+    int32_t count = 0;
+    size_t offset = 0;
+    while (offset < static_cast<size_t>(length)) {
+        uint8_t type = static_cast<uint8_t>(buf[offset]);
+        if (type == COMPACT_RECORD_SENSOR) {
+            offset += sizeof(CompactSensorRecord);
+        } else if (type == COMPACT_RECORD_EVENT) {
+            CompactEventRecord event;
+            if (memcpy_s(&event, sizeof(event), buf + offset, sizeof(event)) != EOK) {
+                return -1;
+            }
+            offset += sizeof(event) + event.dataLen;
+            ++count;
+        } else if (type == COMPACT_RECORD_GAP) {
+            offset += sizeof(CompactGapRecord);
+        } else {
+            return -1;
+        }
+    }
+    return count;
+}
+
+HWTEST_F(SensorDataProcesserTest, SensorDataProcesserTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorDataProcesserTest_001 in");
+    ClientInfo &clientInfo = ClientInfo::GetInstance();
+    ASSERT_EQ(clientInfo.ComputeCoalesceWindow(TEST_SENSOR_DESC, channel_), 0);
+    ASSERT_EQ(SendChangedEvents(EVENT_COUNT), SUCCESS);
+    ASSERT_EQ(CountReceivedEvents(), EVENT_COUNT);
+}
+
+HWTEST_F(SensorDataProcesserTest, SensorDataProcesserTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SensorDataProcesserTest_002 in");
+    ClientInfo &clientInfo = ClientInfo::GetInstance();
+    ASSERT_TRUE(clientInfo.SetCoalesceWindow(TEST_SENSOR_DESC, TEST_PID, COALESCE_WINDOW_NS));
+    ASSERT_EQ(clientInfo.ComputeCoalesceWindow(TEST_SENSOR_DESC, channel_), COALESCE_WINDOW_NS);
+    ASSERT_EQ(SendChangedEvents(EVENT_COUNT), SUCCESS);
+    ASSERT_EQ(CountReceivedEvents(), 1);
+    SensorBasicInfo sensorInfo;
+    sensorInfo.SetSamplingPeriodNs(SAMPLING_PERIOD_NS);
+    sensorInfo.SetMaxReportDelayNs(0);
+    sensorInfo.SetSensorState(true);
+    ASSERT_TRUE(clientInfo.UpdateSensorInfo(TEST_SENSOR_DESC, TEST_PID, sensorInfo));
+    ASSERT_EQ(clientInfo.ComputeCoalesceWindow(TEST_SENSOR_DESC, channel_), COALESCE_WINDOW_NS);
+}
+
+HWTEST_F(SensorDataProcesserTest, SensorDataProcesserTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("SensorDataProcesserTest_003 in");
+    ClientInfo &clientInfo = ClientInfo::GetInstance();
+    ASSERT_FALSE(clientInfo.SetCoalesceWindow(TEST_SENSOR_DESC, TEST_PID + 1, COALESCE_WINDOW_NS));
+    ASSERT_FALSE(clientInfo.SetCoalesceWindow(TEST_SENSOR_DESC, TEST_PID, -1));
+    ASSERT_TRUE(clientInfo.SetCoalesceWindow(TEST_SENSOR_DESC, TEST_PID, 0));
+    ASSERT_EQ(clientInfo.ComputeCoalesceWindow(TEST_SENSOR_DESC, channel_), 0);
+}
+} // namespace Sensors
+} // namespace OHOS
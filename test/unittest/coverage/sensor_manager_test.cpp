@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "client_info.h"
+#include "sensor_errors.h"
+#include "sensor_hdi_connection.h"
+#include "sensor_manager.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorManagerTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t BASE_PID = 100000;
+constexpr int32_t CLIENT_COUNT = 4;
+constexpr int64_t BASE_SAMPLING_PERIOD_NS = 10000000;
+constexpr int32_t RECONFIG_WAIT_MS = 1500;
+} // namespace
+
+class SensorManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+    static bool AddClient(int32_t pid, int64_t samplingPeriodNs);
+
+    static bool isHdiReady_;
+    static SensorDescription sensorDesc_;
+};
+
+bool SensorManagerTest::isHdiReady_ = false;
+SensorDescription SensorManagerTest::sensorDesc_ {};
+
+void SensorManagerTest::SetUpTestCase()
+{
+    SensorHdiConnection &hdiConnection = SensorHdiConnection::GetInstance();
+    std::vector<Sensor> sensors;
+    if ((hdiConnection.ConnectHdi() != ERR_OK) || (hdiConnection.GetSensorList(sensors) != ERR_OK) ||
+        sensors.empty()) {
+        SEN_HILOGW("No sensor available");
+        return;
+    }
+    std::unordered_map<SensorDescription, Sensor> sensorMap;
+    for (const auto &sensor : sensors) {
+        sensorMap.emplace(SensorDescription { sensor.GetDeviceId(), sensor.GetSensorTypeId(), sensor.GetSensorId(),
+            sensor.GetLocation() }, sensor);
+    }
+    sensorDesc_ = sensorMap.begin()->first;
+    SensorManager::GetInstance().InitSensorMap(sensorMap, nullptr, nullptr);
+    isHdiReady_ = true;
+}
+
+bool SensorManagerTest::AddClient(int32_t pid, int64_t samplingPeriodNs)
+{
+    SensorBasicInfo sensorInfo;
+    sensorInfo.SetSamplingPeriodNs(samplingPeriodNs);
+    sensorInfo.SetMaxReportDelayNs(0);
+    sensorInfo.SetSensorState(true);
+    return ClientInfo::GetInstance().UpdateSensorInfo(sensorDesc_, pid, sensorInfo) &&
+        SensorManager::GetInstance().SetBestSensorParams(sensorDesc_, samplingPeriodNs, 0);
+}
+
+HWTEST_F(SensorManagerTest, SensorManagerTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorManagerTest_001 in");
+    if (!isHdiReady_) {
+        return;
+    }
+    SensorManager &sensorManager = SensorManager::GetInstance();
+    for (int32_t i = 0; i < CLIENT_COUNT; ++i) {
+        ASSERT_TRUE(AddClient(BASE_PID + i, BASE_SAMPLING_PERIOD_NS * (i + 1)));
+    }
+    uint32_t batchCount = sensorManager.GetBatchCount(sensorDesc_);
+    ASSERT_GT(batchCount, 0U);
+    // Every departure relaxes the params, the window folds them into one deferred SetBatch
+    for (int32_t i = 0; i < CLIENT_COUNT - 1; ++i) {
+        ASSERT_TRUE(sensorManager.IsOtherClientUsingSensor(sensorDesc_, BASE_PID + i));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(RECONFIG_WAIT_MS));
+    uint32_t reconfigCount = sensorManager.GetBatchCount(sensorDesc_) - batchCount;
+    ClientInfo::GetInstance().ClearCurPidSensorInfo(sensorDesc_, BASE_PID + CLIENT_COUNT - 1);
+    sensorManager.AfterDisableSensor(sensorDesc_);
+    ASSERT_EQ(reconfigCount, 1U);
+}
+} // namespace Sensors
+} // namespace OHOS
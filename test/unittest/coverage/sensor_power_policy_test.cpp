@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "securec.h"
+
+#include "message_schema.h"
+#include "sensor_errors.h"
+#include "sensor_power_policy.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorPowerPolicyTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t BASE_PID = 100000;
+constexpr int32_t UID = 20020000;
+constexpr int32_t DEVICE_ID = 0;
+constexpr int32_t SENSOR_TYPE_ID = 1;
+constexpr int32_t SENSOR_ID = 0;
+constexpr int64_t SAMPLING_PERIOD_NS = 200000000;
+constexpr int64_t MAX_REPORT_DELAY_NS = 0;
+constexpr int32_t INFO_COUNT = 10;
+constexpr int32_t RECEIVE_TIMEOUT_MS = 200;
+constexpr size_t RECEIVE_BUFFER_SIZE = 4096;
+constexpr size_t MAX_RECORD_COUNT = 64;
+} // namespace
+
+class SensorPowerPolicyTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp();
+    void TearDown();
+    SessionPtr CreateSession(int32_t index);
+    std::vector<ActiveInfoRecord> ReceiveRecords(int32_t index, size_t expectCount);
+
+    int32_t fds_[2][2] = { { -1, -1 }, { -1, -1 } };
+};
+
+void SensorPowerPolicyTest::SetUp()
+{
+    for (auto &fd : fds_) {
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fd), 0);
+        struct timeval timeout = { 0, RECEIVE_TIMEOUT_MS * 1000 };
+        ASSERT_EQ(setsockopt(fd[1], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)), 0);
+    }
+}
+
+void SensorPowerPolicyTest::TearDown()
+{
+    for (auto &fd : fds_) {
+        for (auto &end : fd) {
+            if (end >= 0) {
+                close(end);
+                end = -1;
+            }
+        }
+    }
+}
+
+SessionPtr SensorPowerPolicyTest::CreateSession(int32_t index)
+{
+    return std::make_shared<StreamSession>("", fds_[index][0], UID, BASE_PID + index);
+}
+
+std::vector<ActiveInfoRecord> SensorPowerPolicyTest::ReceiveRecords(int32_t index, size_t expectCount)
+{
+    std::vector<ActiveInfoRecord> records;
+    std::vector<char> stream;
+    char buf[RECEIVE_BUFFER_SIZE] = { 0 };
+    while (records.size() < expectCount) {
+        ssize_t length = recv(fds_[index][1], buf, sizeof(buf), 0);
+        if (length <= 0) {
+            break;
+        }
+        stream.insert(stream.end(), buf, buf + length);
+        size_t offset = 0;
+        PackHead head;
+        while ((stream.size() - offset >= sizeof(head)) &&
+            (memcpy_s(&head, sizeof(head), stream.data() + offset, sizeof(head)) == EOK) &&
+            (stream.size() - offset - sizeof(head) >= head.size)) {
+            NetPacket pkt(head.idMsg);
+            if ((head.idMsg != MessageId::ACTIVE_INFO) ||
+                !pkt.Write(stream.data() + offset + sizeof(head), head.size)) {
+                return records;
+            }
+            ActiveInfoRecord received[MAX_RECORD_COUNT];
+            size_t count = 0;
+            if (!DecodeMessage(pkt, received, MAX_RECORD_COUNT, count)) {
+                return records;
+            }
+            records.insert(records.end(), received, received + count);
+            offset += sizeof(head) + head.size;
+        }
+        stream.erase(stream.begin(), stream.begin() + offset);
+    }
+    return records;
+}
+
+HWTEST_F(SensorPowerPolicyTest, SensorPowerPolicyTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPowerPolicyTest_001 in");
+    SensorPowerPolicy &powerPolicy = SensorPowerPolicy::GetInstance();
+    std::vector<SessionPtr> sessionList = { CreateSession(0) };
+    for (int32_t i = 0; i < INFO_COUNT; ++i) {
+        ActiveInfo activeInfo(BASE_PID + i, DEVICE_ID, SENSOR_TYPE_ID, SENSOR_ID, SAMPLING_PERIOD_NS,
+            MAX_REPORT_DELAY_NS);
+        powerPolicy.ReportActiveInfo(activeInfo, sessionList);
+    }
+    std::vector<ActiveInfoRecord> records = ReceiveRecords(0, INFO_COUNT);
+    ASSERT_EQ(records.size(), static_cast<size_t>(INFO_COUNT));
+    for (int32_t i = 0; i < INFO_COUNT; ++i) {
+        ASSERT_EQ(records[i].pid, BASE_PID + i);
+        ASSERT_EQ(records[i].sensorId, SENSOR_ID);
+        ASSERT_EQ(records[i].samplingPeriodNs, SAMPLING_PERIOD_NS);
+        ASSERT_EQ(records[i].maxReportDelayNs, MAX_REPORT_DELAY_NS);
+    }
+}
+
+HWTEST_F(SensorPowerPolicyTest, SensorPowerPolicyTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPowerPolicyTest_002 in");
+    SensorPowerPolicy &powerPolicy = SensorPowerPolicy::GetInstance();
+    SessionPtr first = CreateSession(0);
+    SessionPtr second = CreateSession(1);
+    ActiveInfo activeInfo(BASE_PID, DEVICE_ID, SENSOR_TYPE_ID, SENSOR_ID, SAMPLING_PERIOD_NS, MAX_REPORT_DELAY_NS);
+    powerPolicy.ReportActiveInfo(activeInfo, { first, nullptr, second });
+    ActiveInfo invalidInfo(-1, DEVICE_ID, SENSOR_TYPE_ID, SENSOR_ID, SAMPLING_PERIOD_NS, MAX_REPORT_DELAY_NS);
+    powerPolicy.ReportActiveInfo(invalidInfo, { first, second });
+    for (int32_t index = 0; index < 2; ++index) {
+        std::vector<ActiveInfoRecord> records = ReceiveRecords(index, INFO_COUNT);
+        ASSERT_EQ(records.size(), 1U);
+        ASSERT_EQ(records[0].pid, BASE_PID);
+    }
+}
+
+HWTEST_F(SensorPowerPolicyTest, SensorPowerPolicyTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPowerPolicyTest_003 in");
+    SensorPowerPolicy &powerPolicy = SensorPowerPolicy::GetInstance();
+    std::vector<SessionPtr> sessionList = { CreateSession(0) };
+    powerPolicy.StopActiveInfoSender();
+    ActiveInfo activeInfo(BASE_PID, DEVICE_ID, SENSOR_TYPE_ID, SENSOR_ID, SAMPLING_PERIOD_NS, MAX_REPORT_DELAY_NS);
+    powerPolicy.ReportActiveInfo(activeInfo, sessionList);
+    ASSERT_TRUE(ReceiveRecords(0, 1).empty());
+    powerPolicy.StopActiveInfoSender();
+
+    powerPolicy.StartActiveInfoSender();
+    powerPolicy.ReportActiveInfo(activeInfo, sessionList);
+    std::vector<ActiveInfoRecord> records = ReceiveRecords(0, 1);
+    powerPolicy.StopActiveInfoSender();
+    powerPolicy.StartActiveInfoSender();
+    ASSERT_EQ(records.size(), 1U);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sensor_errors.h"
+#include "sensor_staging_buffer.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorStagingBufferTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t SENSOR_TYPE_ID = 256;
+constexpr uint32_t SAMPLE_COUNT = 10;
+} // namespace
+
+class SensorStagingBufferTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+    void PushSamples(SensorStagingBuffer &staging, uint32_t count);
+};
+
+void SensorStagingBufferTest::PushSamples(SensorStagingBuffer &staging, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i) {
+        float data[1] = { static_cast<float>(i) };
+        SensorEvent event {};
+        event.sensorTypeId = SENSOR_TYPE_ID;
+        event.timestamp = static_cast<int64_t>(i);
+        event.data = reinterpret_cast<uint8_t *>(data);
+        event.dataLen = sizeof(data);
+        ASSERT_TRUE(staging.Push(event));
+    }
+}
+
+HWTEST_F(SensorStagingBufferTest, SensorStagingBufferTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorStagingBufferTest_001 in");
+    SensorStagingBuffer staging;
+    uint64_t readSeq = staging.GetWriteSeq();
+    PushSamples(staging, SAMPLE_COUNT);
+    std::vector<CallbackSensorData> samples;
+    readSeq = staging.Collect(readSeq, false, samples);
+    ASSERT_EQ(readSeq, SAMPLE_COUNT);
+    ASSERT_EQ(samples.size(), SAMPLE_COUNT);
+    for (uint32_t i = 0; i < SAMPLE_COUNT; ++i) {
+        ASSERT_EQ(samples[i].timestamp, static_cast<int64_t>(i));
+        ASSERT_EQ(samples[i].data[0], static_cast<float>(i));
+    }
+    samples.clear();
+    ASSERT_EQ(staging.Collect(readSeq, false, samples), readSeq);
+    ASSERT_TRUE(samples.empty());
+}
+
+HWTEST_F(SensorStagingBufferTest, SensorStagingBufferTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SensorStagingBufferTest_002 in");
+    SensorStagingBuffer staging;
+    PushSamples(staging, SAMPLE_COUNT);
+    std::vector<CallbackSensorData> samples;
+    ASSERT_EQ(staging.Collect(0, true, samples), SAMPLE_COUNT);
+    ASSERT_EQ(samples.size(), 1U);
+    ASSERT_EQ(samples[0].timestamp, static_cast<int64_t>(SAMPLE_COUNT - 1));
+}
+
+HWTEST_F(SensorStagingBufferTest, SensorStagingBufferTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("SensorStagingBufferTest_003 in");
+    SensorStagingBuffer staging;
+    PushSamples(staging, STAGING_CAPACITY + SAMPLE_COUNT);
+    std::vector<CallbackSensorData> samples;
+    ASSERT_EQ(staging.Collect(0, false, samples), STAGING_CAPACITY + SAMPLE_COUNT);
+    ASSERT_EQ(samples.size(), STAGING_CAPACITY);
+    ASSERT_EQ(samples[0].timestamp, static_cast<int64_t>(SAMPLE_COUNT));
+    SensorEvent event {};
+    event.sensorTypeId = SENSOR_TYPE_ID;
+    ASSERT_FALSE(staging.Push(event));
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sensor_errors.h"
+#include "session_table.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SessionTableTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t SESSION_COUNT = 300;
+constexpr int32_t BASE_FD = 1000;
+constexpr int32_t BASE_PID = 5000;
+constexpr int32_t UID = 20020000;
+} // namespace
+
+class SessionTableTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+HWTEST_F(SessionTableTest, SessionTableTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SessionTableTest_001 in");
+    SessionTable sessionTable;
+    for (int32_t i = 0; i < SESSION_COUNT; ++i) {
+        auto sess = std::make_shared<StreamSession>("", BASE_FD + i, UID, BASE_PID + i);
+        ASSERT_TRUE(sessionTable.Insert(sess));
+    }
+    ASSERT_EQ(sessionTable.Size(), static_cast<size_t>(SESSION_COUNT));
+    ASSERT_GT(sessionTable.Size(), MAX_SESSON_ALARM);
+    for (int32_t i = 0; i < SESSION_COUNT; ++i) {
+        SessionPtr byFd = sessionTable.FindByFd(BASE_FD + i);
+        SessionPtr byPid = sessionTable.FindByPid(BASE_PID + i);
+        ASSERT_NE(byFd, nullptr);
+        ASSERT_EQ(byFd, byPid);
+        ASSERT_EQ(byFd->GetPid(), BASE_PID + i);
+    }
+    ASSERT_EQ(sessionTable.FindByFd(BASE_FD + SESSION_COUNT), nullptr);
+    ASSERT_EQ(sessionTable.GetAll().size(), static_cast<size_t>(SESSION_COUNT));
+}
+
+HWTEST_F(SessionTableTest, SessionTableTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SessionTableTest_002 in");
+    SessionTable sessionTable;
+    auto sess = std::make_shared<StreamSession>("", BASE_FD, UID, BASE_PID);
+    ASSERT_TRUE(sessionTable.Insert(sess));
+    ASSERT_EQ(sessionTable.EraseByPid(BASE_PID), sess);
+    ASSERT_EQ(sessionTable.EraseByPid(BASE_PID), nullptr);
+    ASSERT_EQ(sessionTable.FindByFd(BASE_FD), nullptr);
+    ASSERT_EQ(sessionTable.Size(), 0U);
+    ASSERT_TRUE(sessionTable.Insert(sess));
+    ASSERT_EQ(sessionTable.Clear().size(), 1U);
+    ASSERT_EQ(sessionTable.FindByPid(BASE_PID), nullptr);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -655,5 +655,75 @@ HWTEST_F(SensorAgentTest, UnsubscribeSensorPlugTest_002, TestSize.Level1)
     ret = UnsubscribeSensorPlug(&user);
     ASSERT_EQ(ret, OHOS::ERR_OK);
 }
+
+HWTEST_F(SensorAgentTest, SetBusyPollWindowTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SetBusyPollWindowTest_001 in");
+    int32_t ret = SetBusyPollWindow(INVALID_VALUE);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    ret = SetBusyPollWindow(1001);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    ret = GetBusyPollStats(nullptr);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    BusyPollStats stats;
+    ret = GetBusyPollStats(&stats);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ASSERT_EQ(stats.windowUs, 0);
+    ASSERT_EQ(stats.pollCount, 0U);
+}
+
+HWTEST_F(SensorAgentTest, SetBusyPollWindowTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SetBusyPollWindowTest_002 in");
+    SensorUser user;
+    user.callback = SensorDataCallbackImpl;
+    int32_t ret = SetBusyPollWindow(200);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = SubscribeSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = SetBatch(SENSOR_ID, &user, 10000000, 0);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = ActivateSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    ret = DeactivateSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = UnsubscribeSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    BusyPollStats stats;
+    ret = GetBusyPollStats(&stats);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ASSERT_LE(stats.hitCount, stats.pollCount);
+    ASSERT_LE(stats.windowUs, 200);
+    ret = SetBusyPollWindow(0);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+}
+
+HWTEST_F(SensorAgentTest, GetLostEventCountTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("GetLostEventCountTest_001 in");
+    int32_t ret = GetLostEventCount(nullptr);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    uint64_t baseline = UINT64_MAX;
+    ret = GetLostEventCount(&baseline);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    SensorUser user;
+    user.callback = SensorDataCallbackImpl;
+    ret = SubscribeSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = SetBatch(SENSOR_ID, &user, 100000000, 0);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = ActivateSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    ret = DeactivateSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = UnsubscribeSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    uint64_t count = UINT64_MAX;
+    ret = GetLostEventCount(&count);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ASSERT_EQ(count - baseline, 0U);
+}
 } // namespace Sensors
 } // namespace OHOS
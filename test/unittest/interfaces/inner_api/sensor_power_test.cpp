@@ -325,5 +325,44 @@ HWTEST_F(SensorPowerTest, SensorPowerTest_010, TestSize.Level1)
     ret = UnsubscribeSensor(SENSOR_ID, &user);
     ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
 }
+
+HWTEST_F(SensorPowerTest, SensorPowerTest_011, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPowerTest_011 in");
+    int32_t pids[] = { g_processPid, INVALID_VALUE };
+    int32_t ret = SuspendSensorsBatch(pids, sizeof(pids) / sizeof(pids[0]));
+    ASSERT_NE(ret, OHOS::Sensors::SUCCESS);
+    ret = ResumeSensorsBatch(nullptr, 1);
+    ASSERT_NE(ret, OHOS::Sensors::SUCCESS);
+}
+
+HWTEST_F(SensorPowerTest, SensorPowerTest_012, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPowerTest_012 in");
+    SensorUser user;
+    user.callback = SensorDataCallbackImpl;
+
+    int32_t ret = SubscribeSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
+    ret = SetBatch(SENSOR_ID, &user, 100000000, 0);
+    ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
+    ret = ActivateSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    int32_t pids[] = { g_processPid };
+    ret = SuspendSensorsBatch(pids, sizeof(pids) / sizeof(pids[0]));
+    ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    ret = ResumeSensorsBatch(pids, sizeof(pids) / sizeof(pids[0]));
+    ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    ret = DeactivateSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
+    ret = UnsubscribeSensor(SENSOR_ID, &user);
+    ASSERT_EQ(ret, OHOS::Sensors::SUCCESS);
+}
 } // namespace Sensors
 } // namespace OHOS
\ No newline at end of file
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <thread>
 
@@ -35,6 +36,8 @@ using namespace testing::ext;
 using namespace OHOS::HiviewDFX;
 
 namespace {
+constexpr int32_t INVALID_SENSOR_TYPE = -1;
+constexpr int64_t SAMPLING_PERIOD_NS = 200000000;
 static sptr<IRemoteObject> g_remote = new (std::nothrow) IPCObjectStub();
 } // namespace
 
@@ -124,5 +127,51 @@ HWTEST_F(SensorServiceClientTest, LoadSensorServiceTest_001, TestSize.Level1)
     int32_t ret = sensorServiceClient->LoadSensorService();
     EXPECT_EQ(ret, ERR_OK);
 }
+
+HWTEST_F(SensorServiceClientTest, EnableSensorsTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("EnableSensorsTest_001 in");
+    std::vector<int32_t> results;
+    EXPECT_EQ(sensorServiceClient->EnableSensors({}, results), PARAMETER_ERROR);
+    EXPECT_EQ(sensorServiceClient->DisableSensors({}, results), PARAMETER_ERROR);
+    SensorDescriptionIPC invalidDesc(0, INVALID_SENSOR_TYPE, 0, 0);
+    std::vector<SensorEnableInfoIPC> enableInfos(MAX_SENSOR_COUNT + 1,
+        SensorEnableInfoIPC(invalidDesc, SAMPLING_PERIOD_NS, 0));
+    EXPECT_EQ(sensorServiceClient->EnableSensors(enableInfos, results), PARAMETER_ERROR);
+    std::vector<SensorDescription> sensorDescs(MAX_SENSOR_COUNT + 1, {0, INVALID_SENSOR_TYPE, 0, 0});
+    EXPECT_EQ(sensorServiceClient->DisableSensors(sensorDescs, results), PARAMETER_ERROR);
+}
+
+HWTEST_F(SensorServiceClientTest, EnableSensorsTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("EnableSensorsTest_002 in");
+    std::vector<Sensor> sensors = sensorServiceClient->GetSensorList();
+    auto it = std::find_if(sensors.begin(), sensors.end(), [](const Sensor &sensor) {
+        return sensor.GetSensorTypeId() == SENSOR_TYPE_ID_AMBIENT_LIGHT;
+    });
+    if (it == sensors.end()) {
+        SEN_HILOGW("Ambient light sensor does not exist");
+        return;
+    }
+    SensorDescription validDesc = {it->GetDeviceId(), it->GetSensorTypeId(), it->GetSensorId(), it->GetLocation()};
+    SensorDescription invalidDesc = {it->GetDeviceId(), INVALID_SENSOR_TYPE, 0, 0};
+    std::vector<SensorEnableInfoIPC> enableInfos = {
+        SensorEnableInfoIPC({validDesc.deviceId, validDesc.sensorType, validDesc.sensorId, validDesc.location},
+            SAMPLING_PERIOD_NS, 0),
+        SensorEnableInfoIPC({invalidDesc.deviceId, invalidDesc.sensorType, invalidDesc.sensorId,
+            invalidDesc.location}, SAMPLING_PERIOD_NS, 0),
+    };
+    std::vector<int32_t> results;
+    ASSERT_EQ(sensorServiceClient->EnableSensors(enableInfos, results), ERR_OK);
+    ASSERT_EQ(results.size(), enableInfos.size());
+    EXPECT_EQ(results[0], ERR_OK);
+    EXPECT_NE(results[1], ERR_OK);
+
+    std::vector<SensorDescription> sensorDescs = { validDesc, invalidDesc };
+    ASSERT_EQ(sensorServiceClient->DisableSensors(sensorDescs, results), ERR_OK);
+    ASSERT_EQ(results.size(), sensorDescs.size());
+    EXPECT_EQ(results[0], ERR_OK);
+    EXPECT_NE(results[1], ERR_OK);
+}
 } // namespace Sensors
 } // namespace OHOS
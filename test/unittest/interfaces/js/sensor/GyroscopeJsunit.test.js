@@ -572,4 +572,74 @@ describe("GyroscopeJsTest", function () {
             done();
         }
     })
+
+    /*
+    * @tc.number: GyroscopeJsTest_014
+    * @tc.name: GyroscopeJsTest
+    * @tc.desc: verify raw subscription delivers reusable typed array views with ordered samples
+    * @tc.type: FUNC
+    * @tc.require: Issue Number
+    * @tc.size: MediumTest
+    * @tc.type: Function
+    * @tc.level: Level 1
+    */
+    it("GyroscopeJsTest_014", 0, async function (done) {
+        console.info('----------------------GyroscopeJsTest_014---------------------------');
+        const RAW_SAMPLE_STRIDE = 16;
+        const GYROSCOPE_AXES = 3;
+        let lastValues = null;
+        let lastTimestamp = 0n;
+        function rawCallback(values, timestamps, index, count, dropped) {
+            console.info("rawCallback index:" + index + ", count:" + count + ", dropped:" + dropped);
+            expect(values instanceof Float32Array).assertTrue();
+            expect(timestamps instanceof BigInt64Array).assertTrue();
+            expect(values.length).assertEqual(timestamps.length * RAW_SAMPLE_STRIDE);
+            expect(count <= timestamps.length).assertTrue();
+            expect(dropped >= 0).assertTrue();
+            expect(index < timestamps.length).assertTrue();
+            for (let i = 0; i < count; i++) {
+                let slot = (index + i) % timestamps.length;
+                expect(timestamps[slot] > 0n).assertTrue();
+                expect(timestamps[slot] >= lastTimestamp).assertTrue();
+                lastTimestamp = timestamps[slot];
+                for (let axis = 0; axis < RAW_SAMPLE_STRIDE; axis++) {
+                    let value = values[slot * RAW_SAMPLE_STRIDE + axis];
+                    if (axis < GYROSCOPE_AXES) {
+                        expect(Number.isFinite(value)).assertTrue();
+                    } else {
+                        expect(value).assertEqual(0);
+                    }
+                }
+            }
+            if (lastValues != null) {
+                expect(values).assertEqual(lastValues);
+            }
+            lastValues = values;
+        }
+        try {
+            sensor.getSingleSensor(sensor.SensorId.GYROSCOPE, (error, data) => {
+                if (error) {
+                    console.error('getSingleSensor fail, errCode:' + error.code + ' ,msg:' + error.message);
+                    expect(false).assertTrue();
+                    done();
+                }
+                try {
+                    sensor.on(sensor.SensorId.GYROSCOPE, rawCallback, {'interval': 'game', 'raw': true});
+                    setTimeout(() => {
+                        sensor.off(sensor.SensorId.GYROSCOPE, rawCallback);
+                        done();
+                    }, 500);
+                } catch (error) {
+                    console.error('On fail, errCode:' + error.code + ' ,msg:' + error.message);
+                    expect(false).assertTrue();
+                    done();
+                }
+            });
+        } catch (error) {
+            console.error('getSingleSensor fail, errCode:' + error.code + ' ,msg:' + error.message);
+            expect(error.code).assertEqual(CommonConstants.SENSOR_NO_SUPPORT_CODE);
+            expect(error.message).assertEqual(CommonConstants.SENSOR_NO_SUPPOR_MSG);
+            done();
+        }
+    })
 })
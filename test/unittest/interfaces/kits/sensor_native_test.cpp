@@ -38,6 +38,7 @@ constexpr Sensor_Type SENSOR_ID { SENSOR_TYPE_AMBIENT_LIGHT };
 constexpr uint32_t SENSOR_NAME_LENGTH_MAX = 64;
 constexpr int64_t SENSOR_SAMPLE_PERIOD = 200000000;
 constexpr int32_t SLEEP_TIME_MS = 1000;
+constexpr uint32_t POLL_CAPACITY = 32;
 constexpr int64_t INVALID_VALUE = -1;
 constexpr float INVALID_RESOLUTION = -1.0F;
 Sensor_Subscriber *g_user = nullptr;
@@ -682,6 +683,95 @@ HWTEST_F(SensorAgentTest, OH_SensorSubscriber_SetCallback_003, TestSize.Level1)
     ASSERT_EQ(ret, SENSOR_SUCCESS);
 }
 
+HWTEST_F(SensorAgentTest, OH_Sensor_Poll_001, TestSize.Level0)
+{
+    SEN_HILOGI("OH_Sensor_Poll_001 in");
+    if (g_existAmbientLight) {
+        Sensor_SubscriptionId *id = OH_Sensor_CreateSubscriptionId();
+        int32_t ret = OH_SensorSubscriptionId_SetType(id, SENSOR_ID);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        Sensor_SubscriptionAttribute *attr = OH_Sensor_CreateSubscriptionAttribute();
+        ret = OH_SensorSubscriptionAttribute_SetSamplingInterval(attr, SENSOR_SAMPLE_PERIOD);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        Sensor_PollSubscription *subscription = nullptr;
+        ret = OH_Sensor_CreatePollSubscription(id, attr, POLL_CAPACITY, &subscription);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME_MS));
+        Sensor_Event *events[POLL_CAPACITY] = { nullptr };
+        uint32_t count = 0;
+        ret = OH_Sensor_Poll(subscription, events, POLL_CAPACITY, &count);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        for (uint32_t i = 0; i < count; ++i) {
+            SensorDataCallbackImpl(events[i]);
+        }
+        uint64_t droppedCount = 0;
+        ret = OH_Sensor_GetPollDroppedCount(subscription, &droppedCount);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        ret = OH_Sensor_DestroyPollSubscription(subscription);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        if (id != nullptr) {
+            OH_Sensor_DestroySubscriptionId(id);
+        }
+        if (attr != nullptr) {
+            OH_Sensor_DestroySubscriptionAttribute(attr);
+        }
+    }
+}
+
+HWTEST_F(SensorAgentTest, OH_Sensor_Poll_002, TestSize.Level1)
+{
+    SEN_HILOGI("OH_Sensor_Poll_002 in");
+    Sensor_Event *events[POLL_CAPACITY] = { nullptr };
+    uint32_t count = 0;
+    int32_t ret = OH_Sensor_Poll(nullptr, events, POLL_CAPACITY, &count);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    Sensor_PollSubscription *subscription = nullptr;
+    ret = OH_Sensor_CreatePollSubscription(nullptr, nullptr, POLL_CAPACITY, &subscription);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    ret = OH_Sensor_DestroyPollSubscription(nullptr);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+}
+
+HWTEST_F(SensorAgentTest, OH_Sensor_Poll_003, TestSize.Level1)
+{
+    SEN_HILOGI("OH_Sensor_Poll_003 in");
+    if (g_existAmbientLight) {
+        Sensor_SubscriptionId *id = OH_Sensor_CreateSubscriptionId();
+        int32_t ret = OH_SensorSubscriptionId_SetType(id, SENSOR_ID);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        Sensor_SubscriptionAttribute *fastAttr = OH_Sensor_CreateSubscriptionAttribute();
+        ret = OH_SensorSubscriptionAttribute_SetSamplingInterval(fastAttr, SENSOR_SAMPLE_PERIOD);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        Sensor_SubscriptionAttribute *slowAttr = OH_Sensor_CreateSubscriptionAttribute();
+        ret = OH_SensorSubscriptionAttribute_SetSamplingInterval(slowAttr, SENSOR_SAMPLE_PERIOD * 2);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        Sensor_PollSubscription *slowSubscription = nullptr;
+        ret = OH_Sensor_CreatePollSubscription(id, slowAttr, POLL_CAPACITY, &slowSubscription);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        Sensor_PollSubscription *fastSubscription = nullptr;
+        ret = OH_Sensor_CreatePollSubscription(id, fastAttr, POLL_CAPACITY, &fastSubscription);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        // Destroying the fastest subscription lowers the group rate back to the remaining one
+        ret = OH_Sensor_DestroyPollSubscription(fastSubscription);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME_MS));
+        Sensor_Event *events[POLL_CAPACITY] = { nullptr };
+        uint32_t count = 0;
+        ret = OH_Sensor_Poll(slowSubscription, events, POLL_CAPACITY, &count);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        ret = OH_Sensor_DestroyPollSubscription(slowSubscription);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        OH_Sensor_DestroySubscriptionId(id);
+        OH_Sensor_DestroySubscriptionAttribute(fastAttr);
+        OH_Sensor_DestroySubscriptionAttribute(slowAttr);
+    }
+}
+
 HWTEST_F(SensorAgentTest, OH_SensorSubscriber_GetCallback_001, TestSize.Level1)
 {
     SEN_HILOGI("OH_SensorSubscriber_GetCallback_001 in");
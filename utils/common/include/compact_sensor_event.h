@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMPACT_SENSOR_EVENT_H
+#define COMPACT_SENSOR_EVENT_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "sensor.h"
+#include "sensor_data_event.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr uint8_t COMPACT_RECORD_SENSOR = 1;
+constexpr uint8_t COMPACT_RECORD_EVENT = 2;
+constexpr uint8_t COMPACT_RECORD_GAP = 3;
+constexpr uint8_t COMPACT_RECORD_CREDIT = 4;
+constexpr size_t MAX_COMPACT_HANDLE_COUNT = 256;
+constexpr uint32_t INITIAL_CHANNEL_CREDIT = 1024;
+constexpr uint32_t CREDIT_GRANT_BATCH = 64;
+
+#pragma pack(1)
+/**
+ * Binds a handle to the static fields of a sensor and sets the timestamp base of its next event. It is sent
+ * before the first event of a sensor on the channel and again whenever those fields or the base change.
+ */
+struct CompactSensorRecord {
+    uint8_t type { COMPACT_RECORD_SENSOR };
+    uint8_t handle { 0 };
+    int32_t deviceId { 0 };
+    int32_t sensorTypeId { 0 };
+    int32_t sensorId { 0 };
+    int32_t location { 0 };
+    int32_t version { 0 };
+    int32_t option { 0 };
+    int32_t mode { 0 };
+    int64_t timestamp { 0 };
+};
+
+/**
+ * One sample, followed by dataLen payload bytes. timestampDelta is relative to the previous event, or to the
+ * CompactSensorRecord, of the same handle.
+ */
+struct CompactEventRecord {
+    uint8_t type { COMPACT_RECORD_EVENT };
+    uint8_t handle { 0 };
+    uint8_t dataLen { 0 };
+    uint32_t timestampDelta { 0 };
+};
+
+/**
+ * Total number of events the sender has dropped on this channel so far. It precedes the first event sent after
+ * a drop, so the receiver learns about a gap before the events that follow it.
+ */
+struct CompactGapRecord {
+    uint8_t type { COMPACT_RECORD_GAP };
+    uint64_t lostCount { 0 };
+};
+
+/**
+ * Sent by the receiver in the reverse direction to allow the sender another credit events.
+ */
+struct CompactCreditRecord {
+    uint8_t type { COMPACT_RECORD_CREDIT };
+    uint32_t credit { 0 };
+};
+#pragma pack()
+
+/**
+ * Per-channel encoder of SensorData into compact records. The decoder keeps the mirror state, so an encoded
+ * buffer that is not delivered must be followed by Reset() to resend the sensor records.
+ */
+class SensorEventEncoder {
+public:
+    SensorEventEncoder() = default;
+    ~SensorEventEncoder() = default;
+    void Encode(const SensorData *events, size_t count, std::vector<char> &buf);
+    void SetLostCount(uint64_t lostCount);
+    void Reset();
+
+private:
+    uint8_t GetHandle(const SensorData &event);
+    std::unordered_map<SensorDescription, uint8_t> handleMap_;
+    std::vector<CompactSensorRecord> sensorRecords_;
+    std::vector<bool> synced_;
+    uint64_t lostCount_ { 0 };
+    uint64_t reportedLostCount_ { 0 };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // COMPACT_SENSOR_EVENT_H
@@ -16,6 +16,9 @@
 #ifndef PERMISSION_UTIL_H
 #define PERMISSION_UTIL_H
 
+#include <mutex>
+#include <unordered_map>
+
 #include "access_token.h"
 #include "singleton.h"
 
@@ -35,10 +38,19 @@ public:
     int32_t CheckSensorPermission(AccessTokenID callerToken, int32_t sensorTypeId);
     bool IsNativeToken(AccessTokenID callerToken);
     int32_t CheckManageSensorPermission(AccessTokenID callerToken);
+    void SetPermStateListened(bool listened);
+    void InvalidatePermission(AccessTokenID tokenId, const std::string &permissionName);
+    void InvalidateToken(AccessTokenID tokenId);
 
 private:
+    int32_t VerifyPermission(AccessTokenID callerToken, const std::string &permissionName);
+    bool IsUserGrantPermission(const std::string &permissionName);
     void AddPermissionRecord(AccessTokenID tokenID, const std::string &permissionName, bool status);
     static std::unordered_map<int32_t, std::string> sensorPermissions_;
+    std::mutex permCacheMutex_;
+    std::unordered_map<AccessTokenID, std::unordered_map<std::string, int32_t>> permCache_;
+    bool permStateListened_ = false;
+    uint64_t permCacheEpoch_ = 0;
 };
 } // namespace Sensors
 } // namespace OHOS
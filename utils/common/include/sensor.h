@@ -65,6 +65,15 @@ struct SensorDescriptionIPC : public Parcelable {
     static SensorDescriptionIPC* Unmarshalling(Parcel &parcel);
     bool Marshalling(Parcel &parcel) const;
 };
+struct SensorEnableInfoIPC : public Parcelable {
+    SensorDescriptionIPC sensorDesc;
+    int64_t samplingPeriodNs;
+    int64_t maxReportDelayNs;
+    SensorEnableInfoIPC();
+    SensorEnableInfoIPC(const SensorDescriptionIPC &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
+    static SensorEnableInfoIPC* Unmarshalling(Parcel &parcel);
+    bool Marshalling(Parcel &parcel) const;
+};
 class Sensor : public Parcelable {
 public:
     Sensor();
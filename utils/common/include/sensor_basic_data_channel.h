@@ -16,8 +16,14 @@
 #ifndef SENSOR_BASIC_DATA_CHANNEL_H
 #define SENSOR_BASIC_DATA_CHANNEL_H
 
+#include <atomic>
+#include <deque>
+#include <functional>
 #include <mutex>
+#include <vector>
+#include <sys/types.h>
 
+#include "compact_sensor_event.h"
 #include "message_parcel.h"
 #include "sensor.h"
 #include "sensor_data_event.h"
@@ -25,6 +31,15 @@
 namespace OHOS {
 namespace Sensors {
 using ClientExcuteCB = std::function<void(int32_t)>;
+using WritableNotifier = std::function<void(int32_t fd, bool watchWritable)>;
+
+struct CoalescedEvent {
+    SensorData data;
+    int64_t window = 0;
+    int64_t windowEnd = 0;
+    bool pending = false;
+};
+
 class SensorBasicDataChannel : public RefBase {
 public:
     SensorBasicDataChannel();
@@ -38,22 +53,54 @@ public:
     int32_t SendToBinder(MessageParcel &data);
     void CloseSendFd();
     int32_t SendData(const void *vaddr, size_t size);
+    void SetWritableNotifier(WritableNotifier notifier);
+    void FlushPendingData();
+    void ClearPendingData();
+    size_t GetPendingSize();
+    void ReceiveCredit();
+    int32_t GrantCredit(uint32_t credit);
+    void AddLostEventCount(uint64_t count);
+    uint64_t GetLostEventCount();
+    int32_t SetSendBufferSize(int32_t size);
+    int32_t GetSendBufferSize();
     int32_t ReceiveData(ClientExcuteCB callBack, void *vaddr, size_t size);
     bool GetSensorStatus() const;
     void SetSensorStatus(bool isActive);
+    bool IsDead() const;
+    void SetDead();
     const std::unordered_map<SensorDescription, SensorData> &GetDataCacheBuf() const;
+    std::unordered_map<SensorDescription, CoalescedEvent> &GetCoalesceBuf();
     std::string GetPackageName();
     void SetPackageName(std::string packageName);
 
 private:
+    bool FlushPendingDataLocked();
+    bool HasCreditLocked() const;
+    void SyncWritableWatchLocked();
+    ssize_t SendEventsLocked(const char *data, size_t size);
+    void QueuePendingData(const char *data, size_t size);
+    void DropPendingDataLocked();
     std::mutex fdLock_;
     int32_t sendFd_;
     int32_t receiveFd_;
     bool isActive_;
     std::mutex statusLock_;
+    std::atomic_bool isDead_ { false };
     std::unordered_map<SensorDescription, SensorData> dataCacheBuf_;
+    std::unordered_map<SensorDescription, CoalescedEvent> coalesceBuf_;
     std::string packageName_;
     std::mutex pkNameLock_;
+    std::deque<std::vector<char>> pendingData_;
+    WritableNotifier writableNotifier_;
+    bool watchingWritable_ { false };
+    bool socketFull_ { false };
+    size_t pendingEventCount_ { 0 };
+    bool creditEnabled_ { false };
+    int64_t credit_ { 0 };
+    uint64_t lostEventCount_ { 0 };
+    int32_t sendBufferSize_;
+    SensorEventEncoder encoder_;
+    std::vector<char> encodeBuf_;
 };
 } // namespace Sensors
 } // namespace OHOS
@@ -28,6 +28,8 @@ public:
     void SetSamplingPeriodNs(int64_t samplingPeriodNs);
     int64_t GetMaxReportDelayNs() const;
     void SetMaxReportDelayNs(int64_t maxReportDelayNs);
+    int64_t GetCoalesceWindowNs() const;
+    void SetCoalesceWindowNs(int64_t coalesceWindowNs);
     bool GetSensorState() const;
     void SetSensorState(bool sensorState);
     bool GetPermState() const;
@@ -36,6 +38,7 @@ public:
 private:
     int64_t samplingPeriodNs_;
     int64_t maxReportDelayNs_;
+    int64_t coalesceWindowNs_ = 0;
     bool sensorState_ = false;
     bool permState_ = true;
 };
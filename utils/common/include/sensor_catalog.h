@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SENSOR_CATALOG_H
+#define SENSOR_CATALOG_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sensor.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr uint32_t CATALOG_MAGIC = 0x53434154;
+constexpr uint32_t CATALOG_VERSION = 2;
+constexpr uint32_t CATALOG_STRING_LEN = 128;
+constexpr uint32_t CATALOG_MAX_SENSOR_COUNT = 1024;
+
+struct SensorCatalogHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+    uint32_t entrySize;
+    uint32_t sensorCount;
+    std::atomic<uint32_t> isStale;
+    uint32_t reserved;
+};
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "isStale is shared across processes");
+
+struct SensorCatalogEntry {
+    char sensorName[CATALOG_STRING_LEN];
+    char vendorName[CATALOG_STRING_LEN];
+    char firmwareVersion[CATALOG_STRING_LEN];
+    char hardwareVersion[CATALOG_STRING_LEN];
+    int32_t deviceId;
+    int32_t sensorTypeId;
+    int32_t sensorId;
+    int32_t location;
+    float maxRange;
+    float resolution;
+    float power;
+    int32_t fifoMaxEventCount;
+    int64_t minSamplePeriodNs;
+    int64_t maxSamplePeriodNs;
+};
+
+/**
+ * Mapping of a published catalog. The service keeps the only writable mapping and flips isStale when it
+ * publishes a newer generation, clients keep a read-only mapping and poll that flag without any IPC.
+ */
+class SensorCatalogView {
+public:
+    SensorCatalogView() = default;
+    ~SensorCatalogView();
+    SensorCatalogView(const SensorCatalogView &) = delete;
+    SensorCatalogView &operator=(const SensorCatalogView &) = delete;
+    int32_t Map(int32_t fd);
+    void Unmap();
+    bool IsMapped() const;
+    bool IsStale() const;
+    void MarkStale();
+    int32_t Decode(std::vector<Sensor> &sensors, uint64_t &generation) const;
+
+private:
+    friend class SensorCatalog;
+    void *addr_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * Read-only snapshot of the sensor list in a sealed memfd. The service publishes a new snapshot with a
+ * larger generation whenever the list changes, clients map it once instead of unmarshalling every sensor.
+ * The same layout is persisted to disk so that the service can answer list queries at boot before the
+ * HDI enumeration completes.
+ */
+class SensorCatalog {
+public:
+    static int32_t Publish(const std::vector<Sensor> &sensors, uint64_t generation, SensorCatalogView &writer);
+    static int32_t Load(int32_t fd, std::vector<Sensor> &sensors, uint64_t &generation);
+    static int32_t Save(const std::string &path, const std::vector<Sensor> &sensors);
+    static int32_t Restore(const std::string &path, std::vector<Sensor> &sensors);
+    static bool IsSameList(const std::vector<Sensor> &lhs, const std::vector<Sensor> &rhs);
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // SENSOR_CATALOG_H
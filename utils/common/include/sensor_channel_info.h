@@ -38,6 +38,10 @@ public:
     void SetSamplingPeriodNs(int64_t samplingPeriodNs);
     int32_t GetFifoCount() const;
     void SetFifoCount(uint32_t fifoCount);
+    int32_t GetBufferSize() const;
+    void SetBufferSize(int32_t bufferSize);
+    uint64_t GetLostEventCount() const;
+    void SetLostEventCount(uint64_t lostEventCount);
     std::vector<int32_t> GetCmdType() const;
     void SetCmdType(const std::vector<int32_t> &cmdType);
 
@@ -49,6 +53,8 @@ private:
     int32_t sensorId_;
     int64_t samplingPeriodNs_;
     uint32_t fifoCount_;
+    int32_t bufferSize_;
+    uint64_t lostEventCount_;
     std::vector<int32_t> cmdType_;
 };
 } // namespace Sensors
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compact_sensor_event.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Sensors {
+namespace {
+template<typename Record>
+void AppendRecord(std::vector<char> &buf, const Record &record)
+{
+    auto data = reinterpret_cast<const char *>(&record);
+    buf.insert(buf.end(), data, data + sizeof(record));
+}
+} // namespace
+
+uint8_t SensorEventEncoder::GetHandle(const SensorData &event)
+{
+    SensorDescription sensorDesc = {event.deviceId, event.sensorTypeId, event.sensorId, event.location};
+    auto it = handleMap_.find(sensorDesc);
+    if (it != handleMap_.end()) {
+        return it->second;
+    }
+    if (sensorRecords_.size() >= MAX_COMPACT_HANDLE_COUNT) {
+        Reset();
+    }
+    CompactSensorRecord record;
+    record.handle = static_cast<uint8_t>(sensorRecords_.size());
+    record.deviceId = event.deviceId;
+    record.sensorTypeId = event.sensorTypeId;
+    record.sensorId = event.sensorId;
+    record.location = event.location;
+    sensorRecords_.push_back(record);
+    synced_.push_back(false);
+    handleMap_.emplace(sensorDesc, record.handle);
+    return record.handle;
+}
+
+void SensorEventEncoder::Encode(const SensorData *events, size_t count, std::vector<char> &buf)
+{
+    buf.clear();
+    if (events == nullptr) {
+        return;
+    }
+    if (lostCount_ != reportedLostCount_) {
+        CompactGapRecord gapRecord;
+        gapRecord.lostCount = lostCount_;
+        AppendRecord(buf, gapRecord);
+        reportedLostCount_ = lostCount_;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const SensorData &event = events[i];
+        uint8_t handle = GetHandle(event);
+        CompactSensorRecord &record = sensorRecords_[handle];
+        int64_t delta = event.timestamp - record.timestamp;
+        if ((!synced_[handle]) || (record.version != event.version) || (record.option != event.option) ||
+            (record.mode != event.mode) || (delta < 0) || (delta > static_cast<int64_t>(UINT32_MAX))) {
+            record.version = event.version;
+            record.option = event.option;
+            record.mode = event.mode;
+            record.timestamp = event.timestamp;
+            AppendRecord(buf, record);
+            synced_[handle] = true;
+            delta = 0;
+        }
+        CompactEventRecord eventRecord;
+        eventRecord.handle = handle;
+        eventRecord.dataLen = static_cast<uint8_t>(std::min(event.dataLen, static_cast<uint32_t>(SENSOR_MAX_LENGTH)));
+        eventRecord.timestampDelta = static_cast<uint32_t>(delta);
+        AppendRecord(buf, eventRecord);
+        buf.insert(buf.end(), event.data, event.data + eventRecord.dataLen);
+        record.timestamp = event.timestamp;
+    }
+}
+
+void SensorEventEncoder::SetLostCount(uint64_t lostCount)
+{
+    lostCount_ = lostCount;
+}
+
+void SensorEventEncoder::Reset()
+{
+    handleMap_.clear();
+    sensorRecords_.clear();
+    synced_.clear();
+    reportedLostCount_ = 0;
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -45,14 +45,77 @@ int32_t PermissionUtil::CheckSensorPermission(AccessTokenID callerToken, int32_t
         return PERMISSION_GRANTED;
     }
     std::string permissionName = iter->second;
-    int32_t ret = AccessTokenKit::VerifyAccessToken(callerToken, permissionName);
-    if ((permissionName == ACTIVITY_MOTION_PERMISSION)
-        || (permissionName == READ_HEALTH_DATA_PERMISSION)) {
+    int32_t ret = VerifyPermission(callerToken, permissionName);
+    if (IsUserGrantPermission(permissionName)) {
         AddPermissionRecord(callerToken, permissionName, (ret == PERMISSION_GRANTED));
     }
     return ret;
 }
 
+int32_t PermissionUtil::VerifyPermission(AccessTokenID callerToken, const std::string &permissionName)
+{
+    uint64_t epoch = 0;
+    {
+        std::lock_guard<std::mutex> permCacheLock(permCacheMutex_);
+        if (permStateListened_ || !IsUserGrantPermission(permissionName)) {
+            auto tokenIt = permCache_.find(callerToken);
+            if (tokenIt != permCache_.end()) {
+                auto permIt = tokenIt->second.find(permissionName);
+                if (permIt != tokenIt->second.end()) {
+                    return permIt->second;
+                }
+            }
+        }
+        epoch = permCacheEpoch_;
+    }
+    int32_t ret = AccessTokenKit::VerifyAccessToken(callerToken, permissionName);
+    std::lock_guard<std::mutex> permCacheLock(permCacheMutex_);
+    // A grant change seen while verifying may postdate the result, so it is returned without being cached
+    if ((epoch == permCacheEpoch_) && (permStateListened_ || !IsUserGrantPermission(permissionName))) {
+        permCache_[callerToken][permissionName] = ret;
+    }
+    return ret;
+}
+
+bool PermissionUtil::IsUserGrantPermission(const std::string &permissionName)
+{
+    return (permissionName == ACTIVITY_MOTION_PERMISSION) || (permissionName == READ_HEALTH_DATA_PERMISSION);
+}
+
+void PermissionUtil::SetPermStateListened(bool listened)
+{
+    std::lock_guard<std::mutex> permCacheLock(permCacheMutex_);
+    if (permStateListened_ && !listened) {
+        for (auto &tokenIt : permCache_) {
+            tokenIt.second.erase(ACTIVITY_MOTION_PERMISSION);
+            tokenIt.second.erase(READ_HEALTH_DATA_PERMISSION);
+        }
+    }
+    permStateListened_ = listened;
+    ++permCacheEpoch_;
+}
+
+void PermissionUtil::InvalidatePermission(AccessTokenID tokenId, const std::string &permissionName)
+{
+    std::lock_guard<std::mutex> permCacheLock(permCacheMutex_);
+    ++permCacheEpoch_;
+    auto tokenIt = permCache_.find(tokenId);
+    if (tokenIt == permCache_.end()) {
+        return;
+    }
+    tokenIt->second.erase(permissionName);
+    if (tokenIt->second.empty()) {
+        permCache_.erase(tokenIt);
+    }
+}
+
+void PermissionUtil::InvalidateToken(AccessTokenID tokenId)
+{
+    std::lock_guard<std::mutex> permCacheLock(permCacheMutex_);
+    ++permCacheEpoch_;
+    permCache_.erase(tokenId);
+}
+
 void PermissionUtil::AddPermissionRecord(AccessTokenID tokenID, const std::string &permissionName, bool status)
 {
     int32_t successCount = status ? 1 : 0;
@@ -76,7 +139,7 @@ bool PermissionUtil::IsNativeToken(AccessTokenID callerToken)
 
 int32_t PermissionUtil::CheckManageSensorPermission(AccessTokenID callerToken)
 {
-    int32_t ret = AccessTokenKit::VerifyAccessToken(callerToken, MANAGE_SENSOR_PERMISSION);
+    int32_t ret = VerifyPermission(callerToken, MANAGE_SENSOR_PERMISSION);
     if (ret != PERMISSION_GRANTED) {
         SEN_HILOGE("Verify MANAGE_SENSOR permission failed, ret:%{public}d", ret);
     }
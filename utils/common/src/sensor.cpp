@@ -352,5 +352,59 @@ SensorDescriptionIPC* SensorDescriptionIPC::Unmarshalling(Parcel &data)
     }
     return sensorDesc;
 }
+
+SensorEnableInfoIPC::SensorEnableInfoIPC()
+    :samplingPeriodNs(0), maxReportDelayNs(0)
+{}
+
+SensorEnableInfoIPC::SensorEnableInfoIPC(const SensorDescriptionIPC &sensorDesc, int64_t samplingPeriodNs,
+    int64_t maxReportDelayNs)
+    :sensorDesc(sensorDesc), samplingPeriodNs(samplingPeriodNs), maxReportDelayNs(maxReportDelayNs)
+{}
+
+bool SensorEnableInfoIPC::Marshalling(Parcel &parcel) const
+{
+    if (!sensorDesc.Marshalling(parcel)) {
+        SEN_HILOGE("Failed, write sensorDesc failed");
+        return false;
+    }
+    if (!parcel.WriteInt64(samplingPeriodNs)) {
+        SEN_HILOGE("Failed, write samplingPeriodNs failed");
+        return false;
+    }
+    if (!parcel.WriteInt64(maxReportDelayNs)) {
+        SEN_HILOGE("Failed, write maxReportDelayNs failed");
+        return false;
+    }
+    return true;
+}
+
+SensorEnableInfoIPC* SensorEnableInfoIPC::Unmarshalling(Parcel &data)
+{
+    SensorDescriptionIPC *sensorDesc = SensorDescriptionIPC::Unmarshalling(data);
+    if (sensorDesc == nullptr) {
+        SEN_HILOGE("Read sensorDesc failed");
+        return nullptr;
+    }
+    auto enableInfo = new (std::nothrow) SensorEnableInfoIPC();
+    if (enableInfo == nullptr) {
+        SEN_HILOGE("Read init capacity failed");
+        delete sensorDesc;
+        return nullptr;
+    }
+    enableInfo->sensorDesc = *sensorDesc;
+    delete sensorDesc;
+    if (!(data.ReadInt64(enableInfo->samplingPeriodNs))) {
+        SEN_HILOGE("Read samplingPeriodNs failed");
+        delete enableInfo;
+        return nullptr;
+    }
+    if (!(data.ReadInt64(enableInfo->maxReportDelayNs))) {
+        SEN_HILOGE("Read maxReportDelayNs failed");
+        delete enableInfo;
+        return nullptr;
+    }
+    return enableInfo;
+}
 } // namespace Sensors
 } // namespace OHOS
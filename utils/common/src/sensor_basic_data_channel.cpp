@@ -15,6 +15,8 @@
 
 #include "sensor_basic_data_channel.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -34,13 +36,16 @@ using namespace OHOS::HiviewDFX;
 namespace {
 constexpr int32_t SENSOR_READ_DATA_SIZE = sizeof(SensorData) * 100;
 constexpr int32_t DEFAULT_CHANNEL_SIZE = 2 * 1024;
+constexpr int32_t MIN_SEND_BUFFER_SIZE = sizeof(SensorData) * 16;
+constexpr int32_t MAX_SEND_BUFFER_SIZE = sizeof(SensorData) * 2048;
 constexpr int32_t MAX_RECV_LIMIT = 32;
 constexpr int32_t SOCKET_PAIR_SIZE = 2;
-constexpr int32_t SEND_RETRY_LIMIT = 5;
-constexpr int32_t SEND_RETRY_SLEEP_TIME = 500;
+constexpr size_t MAX_PENDING_EVENT_COUNT = 1024;
+constexpr int64_t MAX_CHANNEL_CREDIT = 64 * 1024;
 }  // namespace
 
-SensorBasicDataChannel::SensorBasicDataChannel() : sendFd_(-1), receiveFd_(-1), isActive_(false)
+SensorBasicDataChannel::SensorBasicDataChannel()
+    : sendFd_(-1), receiveFd_(-1), isActive_(false), sendBufferSize_(SENSOR_READ_DATA_SIZE)
 {
     SEN_HILOGD("isActive_:%{public}d, sendFd:%{public}d", isActive_, sendFd_);
 }
@@ -178,43 +183,236 @@ int32_t SensorBasicDataChannel::SendData(const void *vaddr, size_t size)
 {
     CHKPR(vaddr, SENSOR_CHANNEL_SEND_ADDR_ERR);
     auto sensorData = reinterpret_cast<const char *>(vaddr);
-    int32_t idx = 0;
-    int32_t retryCount = 0;
-    int32_t buffSize = static_cast<int32_t>(size);
-    int32_t remSize = buffSize;
-    do {
-        std::unique_lock<std::mutex> lock(fdLock_);
-        if (sendFd_ < 0) {
-            SEN_HILOGE("Failed, param is invalid");
-            return SENSOR_CHANNEL_SEND_ADDR_ERR;
+    std::unique_lock<std::mutex> lock(fdLock_);
+    if ((sendFd_ < 0) || (size == 0) || (size % sizeof(SensorData) != 0)) {
+        SEN_HILOGE("Failed, param is invalid");
+        return SENSOR_CHANNEL_SEND_ADDR_ERR;
+    }
+    if (!FlushPendingDataLocked()) {
+        return SENSOR_CHANNEL_SEND_DATA_ERR;
+    }
+    if (pendingData_.empty() && HasCreditLocked()) {
+        ssize_t length = SendEventsLocked(sensorData, size);
+        if (length >= 0) {
+            return ERR_OK;
         }
-        retryCount++;
-        ssize_t length = send(sendFd_, &sensorData[idx], remSize, MSG_DONTWAIT | MSG_NOSIGNAL);
-        if (length < 0) {
-            if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
-                SEN_HILOGD("Continue for EAGAIN|EINTR|EWOULDBLOCK, errno:%{public}d, sendFd_:%{public}d",
-                    errno, sendFd_);
-                usleep(SEND_RETRY_SLEEP_TIME);
-                continue;
-            }
+        if (errno != EAGAIN && errno != EINTR && errno != EWOULDBLOCK) {
             SEN_HILOGE("Send fail, errno:%{public}d, length:%{public}d, sendFd: %{public}d",
                 errno, static_cast<int32_t>(length), sendFd_);
             return SENSOR_CHANNEL_SEND_DATA_ERR;
         }
-        idx += length;
-        remSize -= length;
-        if (remSize > 0) {
-            usleep(SEND_RETRY_SLEEP_TIME);
+        if (writableNotifier_ == nullptr) {
+            SEN_HILOGE("Channel is full and not watched, drop data, sendFd:%{public}d", sendFd_);
+            return SENSOR_CHANNEL_SEND_DATA_ERR;
+        }
+        SEN_HILOGD("Channel is full, queue data, sendFd:%{public}d", sendFd_);
+        socketFull_ = true;
+    }
+    QueuePendingData(sensorData, size);
+    SyncWritableWatchLocked();
+    return ERR_OK;
+}
+
+void SensorBasicDataChannel::QueuePendingData(const char *data, size_t size)
+{
+    size_t eventCount = size / sizeof(SensorData);
+    uint64_t dropCount = 0;
+    if (eventCount > MAX_PENDING_EVENT_COUNT) {
+        // Keep the newest events of an oversized payload, like the quota does across payloads
+        dropCount += eventCount - MAX_PENDING_EVENT_COUNT;
+        data += (eventCount - MAX_PENDING_EVENT_COUNT) * sizeof(SensorData);
+        size = MAX_PENDING_EVENT_COUNT * sizeof(SensorData);
+        eventCount = MAX_PENDING_EVENT_COUNT;
+    }
+    while (!pendingData_.empty() && (pendingEventCount_ + eventCount > MAX_PENDING_EVENT_COUNT)) {
+        size_t frontCount = pendingData_.front().size() / sizeof(SensorData);
+        pendingEventCount_ -= frontCount;
+        dropCount += frontCount;
+        pendingData_.pop_front();
+    }
+    if (dropCount > 0) {
+        lostEventCount_ += dropCount;
+        SEN_HILOGW("Pending data exceeds quota, drop:%{public}" PRIu64 ", lost:%{public}" PRIu64 ", sendFd:%{public}d",
+            dropCount, lostEventCount_, sendFd_);
+    }
+    pendingData_.emplace_back(data, data + size);
+    pendingEventCount_ += eventCount;
+}
+
+ssize_t SensorBasicDataChannel::SendEventsLocked(const char *data, size_t size)
+{
+    size_t eventCount = size / sizeof(SensorData);
+    encoder_.SetLostCount(lostEventCount_);
+    encoder_.Encode(reinterpret_cast<const SensorData *>(data), eventCount, encodeBuf_);
+    ssize_t length = send(sendFd_, encodeBuf_.data(), encodeBuf_.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (length < 0) {
+        // The receiver never saw the records emitted by this encode, so resend them with the next packet.
+        encoder_.Reset();
+    } else if (creditEnabled_) {
+        credit_ -= static_cast<int64_t>(eventCount);
+    }
+    return length;
+}
+
+bool SensorBasicDataChannel::HasCreditLocked() const
+{
+    return (!creditEnabled_) || (credit_ > 0);
+}
+
+bool SensorBasicDataChannel::FlushPendingDataLocked()
+{
+    socketFull_ = false;
+    while (!pendingData_.empty() && HasCreditLocked()) {
+        const auto &front = pendingData_.front();
+        ssize_t length = SendEventsLocked(front.data(), front.size());
+        if (length >= 0) {
+            pendingEventCount_ -= front.size() / sizeof(SensorData);
+            pendingData_.pop_front();
+            continue;
+        }
+        if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
+            socketFull_ = true;
+            return true;
         }
-    } while (remSize > 0 && retryCount < SEND_RETRY_LIMIT);
-    if ((retryCount >= SEND_RETRY_LIMIT) && (remSize > 0)) {
-        SEN_HILOGE("Send fail, size:%{public}d, retryCount:%{public}d, idx:%{public}d, "
-            "buffSize:%{public}d, errno:%{public}d", buffSize, retryCount, idx, buffSize, errno);
+        SEN_HILOGE("Send pending data fail, errno:%{public}d, sendFd:%{public}d", errno, sendFd_);
+        DropPendingDataLocked();
+        return false;
+    }
+    return true;
+}
+
+void SensorBasicDataChannel::SyncWritableWatchLocked()
+{
+    // Only a full socket is worth waiting for. Data held back for lack of credit is flushed by ReceiveCredit.
+    bool watchWritable = socketFull_ && !pendingData_.empty();
+    if ((writableNotifier_ == nullptr) || (watchWritable == watchingWritable_)) {
+        return;
+    }
+    writableNotifier_(sendFd_, watchWritable);
+    watchingWritable_ = watchWritable;
+}
+
+void SensorBasicDataChannel::FlushPendingData()
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    if (sendFd_ < 0) {
+        DropPendingDataLocked();
+        return;
+    }
+    FlushPendingDataLocked();
+    SyncWritableWatchLocked();
+}
+
+void SensorBasicDataChannel::ClearPendingData()
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    DropPendingDataLocked();
+}
+
+void SensorBasicDataChannel::DropPendingDataLocked()
+{
+    if (pendingEventCount_ > 0) {
+        lostEventCount_ += pendingEventCount_;
+        SEN_HILOGW("Drop pending data, drop:%{public}zu, lost:%{public}" PRIu64 ", sendFd:%{public}d",
+            pendingEventCount_, lostEventCount_, sendFd_);
+    }
+    pendingData_.clear();
+    pendingEventCount_ = 0;
+}
+
+void SensorBasicDataChannel::ReceiveCredit()
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    if (sendFd_ < 0) {
+        return;
+    }
+    CompactCreditRecord record;
+    while (true) {
+        ssize_t length = recv(sendFd_, &record, sizeof(record), MSG_DONTWAIT);
+        if ((length < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (length <= 0) {
+            break;
+        }
+        if ((length != static_cast<ssize_t>(sizeof(record))) || (record.type != COMPACT_RECORD_CREDIT)) {
+            SEN_HILOGW("Invalid credit record, length:%{public}zd, sendFd:%{public}d", length, sendFd_);
+            continue;
+        }
+        creditEnabled_ = true;
+        credit_ = std::min(credit_ + static_cast<int64_t>(record.credit), MAX_CHANNEL_CREDIT);
+    }
+    FlushPendingDataLocked();
+    SyncWritableWatchLocked();
+}
+
+int32_t SensorBasicDataChannel::GrantCredit(uint32_t credit)
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    if (receiveFd_ < 0) {
+        SEN_HILOGE("Failed, receiveFd_ invalid");
+        return SENSOR_CHANNEL_SEND_ADDR_ERR;
+    }
+    CompactCreditRecord record;
+    record.credit = credit;
+    if (send(receiveFd_, &record, sizeof(record), MSG_DONTWAIT | MSG_NOSIGNAL) < 0) {
+        SEN_HILOGD("Grant credit failed, errno:%{public}d, receiveFd:%{public}d", errno, receiveFd_);
         return SENSOR_CHANNEL_SEND_DATA_ERR;
     }
     return ERR_OK;
 }
 
+void SensorBasicDataChannel::AddLostEventCount(uint64_t count)
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    lostEventCount_ += count;
+}
+
+uint64_t SensorBasicDataChannel::GetLostEventCount()
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    return lostEventCount_;
+}
+
+size_t SensorBasicDataChannel::GetPendingSize()
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    return pendingData_.size();
+}
+
+int32_t SensorBasicDataChannel::SetSendBufferSize(int32_t size)
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    if (sendFd_ == -1) {
+        SEN_HILOGE("Failed, sendFd is invalid");
+        return SENSOR_CHANNEL_SENDFD_ERR;
+    }
+    size = std::clamp(size, MIN_SEND_BUFFER_SIZE, MAX_SEND_BUFFER_SIZE);
+    if (size == sendBufferSize_) {
+        return ERR_OK;
+    }
+    if (setsockopt(sendFd_, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)) != 0) {
+        SEN_HILOGE("setsockopt SNDBUF failed, errno:%{public}d", errno);
+        return SENSOR_CHANNEL_SENDFD_ERR;
+    }
+    SEN_HILOGD("Send buffer resized, %{public}d -> %{public}d", sendBufferSize_, size);
+    sendBufferSize_ = size;
+    return ERR_OK;
+}
+
+int32_t SensorBasicDataChannel::GetSendBufferSize()
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    return sendBufferSize_;
+}
+
+void SensorBasicDataChannel::SetWritableNotifier(WritableNotifier notifier)
+{
+    std::unique_lock<std::mutex> lock(fdLock_);
+    writableNotifier_ = notifier;
+    watchingWritable_ = false;
+}
+
 int32_t SensorBasicDataChannel::ReceiveData(ClientExcuteCB callBack, void *vaddr, size_t size)
 {
     if (vaddr == nullptr || callBack == nullptr) {
@@ -266,6 +464,8 @@ int32_t SensorBasicDataChannel::GetReceiveDataFd()
 int32_t SensorBasicDataChannel::DestroySensorBasicChannel()
 {
     std::unique_lock<std::mutex> lock(fdLock_);
+    DropPendingDataLocked();
+    writableNotifier_ = nullptr;
     if (sendFd_ >= 0) {
         fdsan_close_with_tag(sendFd_, TAG);
         sendFd_ = -1;
@@ -284,6 +484,11 @@ const std::unordered_map<SensorDescription, SensorData> &SensorBasicDataChannel:
     return dataCacheBuf_;
 }
 
+std::unordered_map<SensorDescription, CoalescedEvent> &SensorBasicDataChannel::GetCoalesceBuf()
+{
+    return coalesceBuf_;
+}
+
 bool SensorBasicDataChannel::GetSensorStatus() const
 {
     return isActive_;
@@ -297,6 +502,16 @@ void SensorBasicDataChannel::SetSensorStatus(bool isActive)
     return;
 }
 
+bool SensorBasicDataChannel::IsDead() const
+{
+    return isDead_.load(std::memory_order_acquire);
+}
+
+void SensorBasicDataChannel::SetDead()
+{
+    isDead_.store(true, std::memory_order_release);
+}
+
 std::string SensorBasicDataChannel::GetPackageName()
 {
     std::unique_lock<std::mutex> lock(pkNameLock_);
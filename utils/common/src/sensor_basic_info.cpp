@@ -40,6 +40,16 @@ void SensorBasicInfo::SetMaxReportDelayNs(int64_t maxReportDelayNs)
     maxReportDelayNs_ = maxReportDelayNs;
 }
 
+int64_t SensorBasicInfo::GetCoalesceWindowNs() const
+{
+    return coalesceWindowNs_;
+}
+
+void SensorBasicInfo::SetCoalesceWindowNs(int64_t coalesceWindowNs)
+{
+    coalesceWindowNs_ = coalesceWindowNs;
+}
+
 bool SensorBasicInfo::GetSensorState() const
 {
     return sensorState_;
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensor_catalog.h"
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "securec.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorCatalog"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+namespace {
+#ifndef F_SEAL_FUTURE_WRITE
+#define F_SEAL_FUTURE_WRITE 0x0010
+#endif
+const char *CATALOG_NAME = "sensor_catalog";
+// F_SEAL_FUTURE_WRITE still lets the service flip isStale through the mapping it made before sealing
+constexpr unsigned int CATALOG_SEALS = F_SEAL_SEAL | F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_FUTURE_WRITE;
+
+bool CopyString(char *dest, const std::string &src)
+{
+    return strncpy_s(dest, CATALOG_STRING_LEN, src.c_str(), CATALOG_STRING_LEN - 1) == EOK;
+}
+
+bool FillEntry(const Sensor &sensor, SensorCatalogEntry &entry)
+{
+    if (!CopyString(entry.sensorName, sensor.GetSensorName()) ||
+        !CopyString(entry.vendorName, sensor.GetVendorName()) ||
+        !CopyString(entry.firmwareVersion, sensor.GetFirmwareVersion()) ||
+        !CopyString(entry.hardwareVersion, sensor.GetHardwareVersion())) {
+        SEN_HILOGE("strncpy_s failed, sensorTypeId:%{public}d", sensor.GetSensorTypeId());
+        return false;
+    }
+    entry.deviceId = sensor.GetDeviceId();
+    entry.sensorTypeId = sensor.GetSensorTypeId();
+    entry.sensorId = sensor.GetSensorId();
+    entry.location = sensor.GetLocation();
+    entry.maxRange = sensor.GetMaxRange();
+    entry.resolution = sensor.GetResolution();
+    entry.power = sensor.GetPower();
+    entry.fifoMaxEventCount = sensor.GetFifoMaxEventCount();
+    entry.minSamplePeriodNs = sensor.GetMinSamplePeriodNs();
+    entry.maxSamplePeriodNs = sensor.GetMaxSamplePeriodNs();
+    return true;
+}
+
+void FillSensor(const SensorCatalogEntry &entry, Sensor &sensor)
+{
+    sensor.SetSensorName(std::string(entry.sensorName, strnlen(entry.sensorName, CATALOG_STRING_LEN)));
+    sensor.SetVendorName(std::string(entry.vendorName, strnlen(entry.vendorName, CATALOG_STRING_LEN)));
+    sensor.SetFirmwareVersion(std::string(entry.firmwareVersion,
+        strnlen(entry.firmwareVersion, CATALOG_STRING_LEN)));
+    sensor.SetHardwareVersion(std::string(entry.hardwareVersion,
+        strnlen(entry.hardwareVersion, CATALOG_STRING_LEN)));
+    sensor.SetDeviceId(entry.deviceId);
+    sensor.SetSensorTypeId(entry.sensorTypeId);
+    sensor.SetSensorId(entry.sensorId);
+    sensor.SetLocation(entry.location);
+    sensor.SetMaxRange(entry.maxRange);
+    sensor.SetResolution(entry.resolution);
+    sensor.SetPower(entry.power);
+    sensor.SetFifoMaxEventCount(entry.fifoMaxEventCount);
+    sensor.SetMinSamplePeriodNs(entry.minSamplePeriodNs);
+    sensor.SetMaxSamplePeriodNs(entry.maxSamplePeriodNs);
+}
+
+bool Encode(const std::vector<Sensor> &sensors, uint64_t generation, std::vector<uint8_t> &buffer)
+{
+    if (sensors.size() > CATALOG_MAX_SENSOR_COUNT) {
+        SEN_HILOGE("Too many sensors, count:%{public}zu", sensors.size());
+        return false;
+    }
+    buffer.assign(sizeof(SensorCatalogHeader) + sensors.size() * sizeof(SensorCatalogEntry), 0);
+    auto header = reinterpret_cast<SensorCatalogHeader *>(buffer.data());
+    header->magic = CATALOG_MAGIC;
+    header->version = CATALOG_VERSION;
+    header->generation = generation;
+    header->entrySize = sizeof(SensorCatalogEntry);
+    header->sensorCount = static_cast<uint32_t>(sensors.size());
+    auto entries = reinterpret_cast<SensorCatalogEntry *>(buffer.data() + sizeof(SensorCatalogHeader));
+    for (size_t i = 0; i < sensors.size(); ++i) {
+        if (!FillEntry(sensors[i], entries[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Decode(const uint8_t *addr, size_t size, std::vector<Sensor> &sensors, uint64_t &generation)
+{
+    if (size < sizeof(SensorCatalogHeader)) {
+        SEN_HILOGE("Invalid catalog size");
+        return false;
+    }
+    auto header = reinterpret_cast<const SensorCatalogHeader *>(addr);
+    if (header->magic != CATALOG_MAGIC || header->version != CATALOG_VERSION ||
+        header->entrySize != sizeof(SensorCatalogEntry) || header->sensorCount > CATALOG_MAX_SENSOR_COUNT ||
+        size < sizeof(SensorCatalogHeader) + header->sensorCount * sizeof(SensorCatalogEntry)) {
+        SEN_HILOGE("Invalid catalog header");
+        return false;
+    }
+    auto entries = reinterpret_cast<const SensorCatalogEntry *>(addr + sizeof(SensorCatalogHeader));
+    sensors.clear();
+    sensors.resize(header->sensorCount);
+    for (uint32_t i = 0; i < header->sensorCount; ++i) {
+        FillSensor(entries[i], sensors[i]);
+    }
+    generation = header->generation;
+    return true;
+}
+
+bool WriteAll(int32_t fd, const std::vector<uint8_t> &buffer)
+{
+    size_t offset = 0;
+    while (offset < buffer.size()) {
+        ssize_t length = write(fd, buffer.data() + offset, buffer.size() - offset);
+        if (length < 0 && errno == EINTR) {
+            continue;
+        }
+        if (length <= 0) {
+            SEN_HILOGE("Write catalog failed, errno:%{public}d", errno);
+            return false;
+        }
+        offset += static_cast<size_t>(length);
+    }
+    return true;
+}
+
+bool ReadAll(const std::string &path, std::vector<uint8_t> &buffer)
+{
+    int32_t fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStat;
+    size_t maxSize = sizeof(SensorCatalogHeader) + CATALOG_MAX_SENSOR_COUNT * sizeof(SensorCatalogEntry);
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 || static_cast<size_t>(fileStat.st_size) > maxSize) {
+        close(fd);
+        return false;
+    }
+    buffer.resize(static_cast<size_t>(fileStat.st_size));
+    size_t offset = 0;
+    while (offset < buffer.size()) {
+        ssize_t length = read(fd, buffer.data() + offset, buffer.size() - offset);
+        if (length < 0 && errno == EINTR) {
+            continue;
+        }
+        if (length <= 0) {
+            close(fd);
+            return false;
+        }
+        offset += static_cast<size_t>(length);
+    }
+    close(fd);
+    return true;
+}
+} // namespace
+
+SensorCatalogView::~SensorCatalogView()
+{
+    Unmap();
+}
+
+int32_t SensorCatalogView::Map(int32_t fd)
+{
+    if (fd < 0) {
+        SEN_HILOGE("Invalid catalog fd");
+        return ERROR;
+    }
+    int32_t seals = fcntl(fd, F_GET_SEALS);
+    if (seals < 0 || (static_cast<unsigned int>(seals) & CATALOG_SEALS) != CATALOG_SEALS) {
+        SEN_HILOGE("Catalog is not sealed, seals:%{public}d", seals);
+        return ERROR;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(SensorCatalogHeader))) {
+        SEN_HILOGE("Invalid catalog size");
+        return ERROR;
+    }
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void *addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        SEN_HILOGE("mmap failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    Unmap();
+    addr_ = addr;
+    size_ = size;
+    return ERR_OK;
+}
+
+void SensorCatalogView::Unmap()
+{
+    if (addr_ != nullptr) {
+        munmap(addr_, size_);
+        addr_ = nullptr;
+        size_ = 0;
+    }
+}
+
+bool SensorCatalogView::IsMapped() const
+{
+    return addr_ != nullptr;
+}
+
+bool SensorCatalogView::IsStale() const
+{
+    if (addr_ == nullptr) {
+        return true;
+    }
+    return static_cast<const SensorCatalogHeader *>(addr_)->isStale.load(std::memory_order_acquire) != 0;
+}
+
+void SensorCatalogView::MarkStale()
+{
+    if (addr_ != nullptr) {
+        static_cast<SensorCatalogHeader *>(addr_)->isStale.store(1, std::memory_order_release);
+    }
+}
+
+int32_t SensorCatalogView::Decode(std::vector<Sensor> &sensors, uint64_t &generation) const
+{
+    if (addr_ == nullptr) {
+        SEN_HILOGE("Catalog is not mapped");
+        return ERROR;
+    }
+    return Sensors::Decode(static_cast<const uint8_t *>(addr_), size_, sensors, generation) ? ERR_OK : ERROR;
+}
+
+int32_t SensorCatalog::Publish(const std::vector<Sensor> &sensors, uint64_t generation, SensorCatalogView &writer)
+{
+    std::vector<uint8_t> buffer;
+    if (!Encode(sensors, generation, buffer)) {
+        return -1;
+    }
+    int32_t fd = memfd_create(CATALOG_NAME, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+        SEN_HILOGE("memfd_create failed, errno:%{public}d", errno);
+        return -1;
+    }
+    if (!WriteAll(fd, buffer)) {
+        close(fd);
+        return -1;
+    }
+    void *addr = mmap(nullptr, buffer.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        SEN_HILOGE("mmap failed, errno:%{public}d", errno);
+        close(fd);
+        return -1;
+    }
+    if (fcntl(fd, F_ADD_SEALS, CATALOG_SEALS) != 0) {
+        SEN_HILOGE("Seal catalog failed, errno:%{public}d", errno);
+        munmap(addr, buffer.size());
+        close(fd);
+        return -1;
+    }
+    writer.Unmap();
+    writer.addr_ = addr;
+    writer.size_ = buffer.size();
+    SEN_HILOGI("Catalog published, generation:%{public}" PRIu64 ", count:%{public}zu", generation, sensors.size());
+    return fd;
+}
+
+int32_t SensorCatalog::Load(int32_t fd, std::vector<Sensor> &sensors, uint64_t &generation)
+{
+    SensorCatalogView view;
+    if (view.Map(fd) != ERR_OK) {
+        return ERROR;
+    }
+    return view.Decode(sensors, generation);
+}
+
+int32_t SensorCatalog::Save(const std::string &path, const std::vector<Sensor> &sensors)
+{
+    std::vector<uint8_t> buffer;
+    if (!Encode(sensors, 0, buffer)) {
+        return ERROR;
+    }
+    std::vector<uint8_t> current;
+    if (ReadAll(path, current) && (current == buffer)) {
+        SEN_HILOGD("Sensor list cache is up to date");
+        return ERR_OK;
+    }
+    std::string tmpPath = path + ".tmp";
+    int32_t fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        SEN_HILOGE("Open cache failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    if (!WriteAll(fd, buffer) || (fsync(fd) != 0)) {
+        close(fd);
+        unlink(tmpPath.c_str());
+        return ERROR;
+    }
+    close(fd);
+    if (rename(tmpPath.c_str(), path.c_str()) != 0) {
+        SEN_HILOGE("Rename cache failed, errno:%{public}d", errno);
+        unlink(tmpPath.c_str());
+        return ERROR;
+    }
+    SEN_HILOGI("Sensor list cache saved, count:%{public}zu", sensors.size());
+    return ERR_OK;
+}
+
+int32_t SensorCatalog::Restore(const std::string &path, std::vector<Sensor> &sensors)
+{
+    std::vector<uint8_t> buffer;
+    if (!ReadAll(path, buffer)) {
+        SEN_HILOGW("No sensor list cache");
+        return ERROR;
+    }
+    uint64_t generation = 0;
+    if (!Decode(buffer.data(), buffer.size(), sensors, generation)) {
+        return ERROR;
+    }
+    return ERR_OK;
+}
+
+bool SensorCatalog::IsSameList(const std::vector<Sensor> &lhs, const std::vector<Sensor> &rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    std::vector<uint8_t> lhsBuffer;
+    std::vector<uint8_t> rhsBuffer;
+    return Encode(lhs, 0, lhsBuffer) && Encode(rhs, 0, rhsBuffer) && (lhsBuffer == rhsBuffer);
+}
+} // namespace Sensors
+} // namespace OHOS
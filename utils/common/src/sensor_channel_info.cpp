@@ -18,7 +18,7 @@
 namespace OHOS {
 namespace Sensors {
 SensorChannelInfo::SensorChannelInfo() : uid_(0), deviceId_(0), sensorType_(0), sensorId_(0), samplingPeriodNs_(0),
-    fifoCount_(0)
+    fifoCount_(0), bufferSize_(0), lostEventCount_(0)
 {}
 
 int32_t SensorChannelInfo::GetUid() const
@@ -91,6 +91,26 @@ void SensorChannelInfo::SetFifoCount(uint32_t fifoCount)
     fifoCount_ = fifoCount;
 }
 
+int32_t SensorChannelInfo::GetBufferSize() const
+{
+    return bufferSize_;
+}
+
+void SensorChannelInfo::SetBufferSize(int32_t bufferSize)
+{
+    bufferSize_ = bufferSize;
+}
+
+uint64_t SensorChannelInfo::GetLostEventCount() const
+{
+    return lostEventCount_;
+}
+
+void SensorChannelInfo::SetLostEventCount(uint64_t lostEventCount)
+{
+    lostEventCount_ = lostEventCount;
+}
+
 std::vector<int32_t> SensorChannelInfo::GetCmdType() const
 {
     return cmdType_;
@@ -16,24 +16,49 @@
 #ifndef CIRCLE_STREAM_BUFFER_H
 #define CIRCLE_STREAM_BUFFER_H
 
-#include "stream_buffer.h"
+#include <memory>
+#include <vector>
 
-#undef LOG_TAG
-#define LOG_TAG "CircleStreamBuffer"
+#include "nocopyable.h"
+
+#include "proto.h"
+#ifdef OHOS_BUILD_ENABLE_RUST
+#include "rust_binding.h"
+#endif // OHOS_BUILD_ENABLE_RUST
 
 namespace OHOS {
 namespace Sensors {
-class CircleStreamBuffer : public StreamBuffer {
+/**
+ * Byte ring used to reassemble packets received on the client socket. The capacity is rounded up to
+ * a power of two so positions are masked instead of compacted, unread bytes never move.
+ */
+class CircleStreamBuffer {
 public:
-    CircleStreamBuffer() = default;
+    explicit CircleStreamBuffer(size_t capacity = DEFAULT_CIRCLE_BUF_SIZE);
     ~CircleStreamBuffer() = default;
-    bool CheckWrite(size_t size);
-    bool Write(const char *buf, size_t size) override;
-    DISALLOW_MOVE(CircleStreamBuffer);
+    bool CheckWrite(size_t size) const;
+    bool Write(const char *buf, size_t size);
+    bool Peek(size_t offset, char *buf, size_t size) const;
+    bool SeekReadPos(size_t n);
+    void Reset();
+    bool IsEmpty() const;
+    size_t UnreadSize() const;
+    size_t ContiguousReadSize() const;
+    size_t Capacity() const;
+    const char *ReadBuf() const;
+    DISALLOW_COPY_AND_MOVE(CircleStreamBuffer);
 
-protected:
-    void CopyDataToBegin();
+#ifdef OHOS_BUILD_ENABLE_RUST
+    std::unique_ptr<RustCircleStreamBuffer, void(*)(RustCircleStreamBuffer*)> circleBufferPtr_ {
+        nullptr, CircleStreamBufferDelete };
+#else
+private:
+    std::vector<char> ring_;
+    size_t mask_ { 0 };
+    size_t rPos_ { 0 };
+    size_t wPos_ { 0 };
+#endif // OHOS_BUILD_ENABLE_RUST
 };
 } // namespace Sensors
 } // namespace OHOS
-#endif // CIRCLE_STREAM_BUFFER_H
\ No newline at end of file
+#endif // CIRCLE_STREAM_BUFFER_H
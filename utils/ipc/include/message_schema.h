@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MESSAGE_SCHEMA_H
+#define MESSAGE_SCHEMA_H
+
+#include <algorithm>
+#include <type_traits>
+
+#include "net_packet.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr uint16_t MESSAGE_SCHEMA_VERSION = 1;
+constexpr uint16_t MAX_MESSAGE_RECORD_SIZE = 128;
+
+#pragma pack(1)
+/**
+ * Prefix of every schema message payload, followed by recordCount records of recordSize bytes each. A reader
+ * ignores trailing fields appended by a newer writer and keeps the defaults of fields an older writer lacks.
+ */
+struct MessageHeader {
+    uint16_t version { MESSAGE_SCHEMA_VERSION };
+    uint16_t recordSize { 0 };
+    uint32_t recordCount { 0 };
+};
+
+/**
+ * Record of MessageId::ACTIVE_INFO. New fields may only be appended.
+ */
+struct ActiveInfoRecord {
+    int32_t pid { -1 };
+    int32_t sensorId { -1 };
+    int64_t samplingPeriodNs { -1 };
+    int64_t maxReportDelayNs { -1 };
+};
+#pragma pack()
+
+template<typename Record>
+bool EncodeMessage(NetPacket &pkt, const Record *records, size_t count)
+{
+    static_assert(std::is_trivially_copyable<Record>::value, "Record must be trivially copyable");
+    static_assert(sizeof(Record) <= MAX_MESSAGE_RECORD_SIZE, "Record is too large");
+    MessageHeader head;
+    head.recordSize = static_cast<uint16_t>(sizeof(Record));
+    head.recordCount = static_cast<uint32_t>(count);
+    if (!pkt.Write(head)) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+    CHKPF(records);
+    return pkt.Write(reinterpret_cast<const char *>(records), count * sizeof(Record));
+}
+
+template<typename Record>
+bool DecodeMessage(NetPacket &pkt, Record *records, size_t maxCount, size_t &count)
+{
+    static_assert(std::is_trivially_copyable<Record>::value, "Record must be trivially copyable");
+    CHKPF(records);
+    MessageHeader head;
+    if (!pkt.Read(head)) {
+        return false;
+    }
+    if ((head.version == 0) || (head.recordSize == 0) || (head.recordSize > MAX_MESSAGE_RECORD_SIZE) ||
+        (head.recordCount > maxCount)) {
+        SEN_HILOGE("Invalid message, version:%{public}u, recordSize:%{public}u, recordCount:%{public}u",
+            head.version, head.recordSize, head.recordCount);
+        return false;
+    }
+    char raw[MAX_MESSAGE_RECORD_SIZE] = {};
+    size_t copySize = std::min(static_cast<size_t>(head.recordSize), sizeof(Record));
+    for (size_t i = 0; i < head.recordCount; ++i) {
+        if (!pkt.Read(raw, head.recordSize)) {
+            return false;
+        }
+        records[i] = Record {};
+        if (memcpy_s(&records[i], sizeof(Record), raw, copySize) != EOK) {
+            SEN_HILOGE("memcpy_s failed");
+            return false;
+        }
+    }
+    count = head.recordCount;
+    return true;
+}
+} // namespace Sensors
+} // namespace OHOS
+#endif // MESSAGE_SCHEMA_H
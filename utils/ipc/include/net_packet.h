@@ -36,7 +36,10 @@ public:
     NetPacket(const NetPacket &pkt);
     NetPacket &operator = (const NetPacket &pkt);
     ~NetPacket() = default;
+    void Reset(MessageId msgId);
     void MakeData(StreamBuffer &buf) const;
+    PackHead MakeHead() const;
+    const char *GetPayload() const;
     size_t GetSize() const;
     size_t GetPacketLength() const;
     const char *GetData() const;
@@ -20,14 +20,16 @@
 
 namespace OHOS {
 namespace Sensors {
-static constexpr size_t SEND_RETRY_LIMIT = 32;
-static constexpr size_t SEND_RETRY_SLEEP_TIME = 10000;
 static constexpr size_t MAX_VECTOR_SIZE = 10;
 static constexpr size_t MAX_SESSON_ALARM = 100;
+static constexpr size_t MAX_SESSION_COUNT = 4096;
 static constexpr size_t MAX_RECV_LIMIT = 13;
 static constexpr size_t MAX_STREAM_BUF_SIZE = 256;
 static constexpr size_t MAX_PACKET_BUF_SIZE = 256;
+static constexpr size_t MAX_SESSION_OUTPUT_SIZE = 64 * 1024;
+static constexpr size_t DEFAULT_CIRCLE_BUF_SIZE = 4096;
 static constexpr size_t ONCE_PROCESS_NETPACKET_LIMIT = 100;
+static constexpr size_t MAX_ACTIVE_INFO_BATCH = 8;
 
 enum class MessageId : int32_t {
     INVALID,
@@ -17,12 +17,14 @@
 #define RUST_BINDING_H
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 #include "proto.h"
 
 extern "C" {
     struct RustStreamSocket;
     struct RustStreamSession;
     struct RustStreamBuffer;
+    struct RustCircleStreamBuffer;
     struct RustNetPacket {
         OHOS::Sensors::MessageId msgId { OHOS::Sensors::MessageId::INVALID };
         struct RustStreamBuffer *streamBuffer;
@@ -39,6 +41,7 @@ extern "C" {
     void StreamSessionSetFd(RustStreamSession *rustStreamSession, int32_t fd);
     void StreamSessionClose(RustStreamSession *rustStreamSession);
     bool StreamSessionSendMsg(const RustStreamSession *rustStreamSession, const char *buf, size_t size);
+    ssize_t StreamSessionTrySendIov(const RustStreamSession *rustStreamSession, const struct iovec *iov, size_t iovCount);
     int32_t StreamSessionGetUid(const RustStreamSession *rustStreamSession);
     int32_t StreamSessionGetPid(const RustStreamSession *rustStreamSession);
     int32_t StreamSessionGetFd(const RustStreamSession *rustStreamSession);
@@ -65,8 +68,17 @@ extern "C" {
     size_t StreamBufferSize(const RustStreamBuffer *rustStreamBuffer);
     const char *StreamBufferGetErrorStatusRemark(const RustStreamBuffer *rustStreamBuffer);
     bool StreamBufferChkRWError(const RustStreamBuffer *rustStreamBuffer);
-    bool StreamBufferCheckWrite(RustStreamBuffer *rustStreamBuffer, size_t size);
-    bool CircleStreamBufferWrite(RustStreamBuffer *rustStreamBuffer, const char *buf, size_t size);
-    void CircleStreamBufferCopyDataToBegin(RustStreamBuffer *rustStreamBuffer);
+    RustCircleStreamBuffer *CircleStreamBufferCreate(size_t capacity);
+    void CircleStreamBufferDelete(RustCircleStreamBuffer *raw);
+    bool CircleStreamBufferCheckWrite(const RustCircleStreamBuffer *rustCircleStreamBuffer, size_t size);
+    bool CircleStreamBufferWrite(RustCircleStreamBuffer *rustCircleStreamBuffer, const char *buf, size_t size);
+    bool CircleStreamBufferPeek(const RustCircleStreamBuffer *rustCircleStreamBuffer, size_t offset, char *buf,
+        size_t size);
+    bool CircleStreamBufferSeekReadPos(RustCircleStreamBuffer *rustCircleStreamBuffer, size_t n);
+    int32_t CircleStreamBufferReset(RustCircleStreamBuffer *rustCircleStreamBuffer);
+    size_t CircleStreamBufferUnreadSize(const RustCircleStreamBuffer *rustCircleStreamBuffer);
+    size_t CircleStreamBufferContiguousReadSize(const RustCircleStreamBuffer *rustCircleStreamBuffer);
+    size_t CircleStreamBufferCapacity(const RustCircleStreamBuffer *rustCircleStreamBuffer);
+    const char *CircleStreamBufferReadBuf(const RustCircleStreamBuffer *rustCircleStreamBuffer);
 }
 #endif // RUST_BINDING_H
\ No newline at end of file
@@ -16,7 +16,11 @@
 #ifndef STREAM_SESSION_H
 #define STREAM_SESSION_H
 
+#include <functional>
 #include <map>
+#include <mutex>
+#include <sys/uio.h>
+#include <vector>
 
 #include "accesstoken_kit.h"
 
@@ -33,6 +37,7 @@ using SessionPtr = std::shared_ptr<StreamSession>;
 using namespace Security::AccessToken;
 class StreamSession : public std::enable_shared_from_this<StreamSession> {
 public:
+    using WritableNotifier = std::function<void(int32_t fd, bool watchWritable)>;
     StreamSession(const std::string &programName, const int32_t fd, const int32_t uid, const int32_t pid);
     ~StreamSession() = default;
     bool SendMsg(const char *buf, size_t size) const;
@@ -42,22 +47,33 @@ public:
     int32_t GetPid() const;
     SessionPtr GetSharedPtr();
     int32_t GetFd() const;
-    const std::string &GetDescript() const;
+    std::string GetDescript() const;
     const std::string GetProgramName() const;
     void SetTokenType(int32_t type);
     int32_t GetTokenType() const;
-    void UpdateDescript();
+    void SetWritableNotifier(WritableNotifier notifier);
+    void FlushOutput();
+    void ClearOutput();
+    size_t GetOutputSize() const;
+    size_t GetMemorySize() const;
     DISALLOW_COPY_AND_MOVE(StreamSession);
 
 protected:
+    bool SendIov(const struct iovec *iov, size_t iovCount) const;
+    ssize_t TrySendIov(const struct iovec *iov, size_t iovCount) const;
+    bool FlushOutputLocked() const;
+    bool QueueOutput(const struct iovec *iov, size_t iovCount, size_t skip) const;
     struct EventTime {
         int32_t id { 0 };
         int64_t eventTime { 0 };
         int32_t timerId { -1 };
     };
+    mutable std::mutex eventsMutex_;
     std::map<int32_t, std::vector<EventTime>> events_;
-    std::string descript_;
     const std::string programName_;
+    mutable std::mutex outputMutex_;
+    mutable std::vector<char> outputBuf_;
+    WritableNotifier writableNotifier_;
 #ifdef OHOS_BUILD_ENABLE_RUST
     std::unique_ptr<RustStreamSession, void(*)(RustStreamSession*)> streamSessionPtr_ { StreamSessionCreate(),
         StreamSessionDelete };
@@ -16,7 +16,7 @@
 #ifndef STREAM_SOCKET_H
 #define STREAM_SOCKET_H
 
-
+#include <functional>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -15,53 +15,161 @@
 
 #include "circle_stream_buffer.h"
 
+#include <algorithm>
+
+#include "securec.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CircleStreamBuffer"
+
 namespace OHOS {
 namespace Sensors {
-bool CircleStreamBuffer::CheckWrite(size_t size)
+namespace {
+size_t RoundUpPowerOfTwo(size_t capacity)
+{
+    size_t size = MAX_STREAM_BUF_SIZE;
+    while (size < capacity && size <= (SIZE_MAX >> 1)) {
+        size <<= 1;
+    }
+    return size;
+}
+} // namespace
+
+CircleStreamBuffer::CircleStreamBuffer(size_t capacity)
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
-    return StreamBufferCheckWrite(streamBufferPtr_.get(), size);
+    circleBufferPtr_.reset(CircleStreamBufferCreate(RoundUpPowerOfTwo(capacity)));
 #else
-    size_t availSize = GetAvailableBufSize();
-    if (size > availSize && rPos_ > 0) {
-        CopyDataToBegin();
-        availSize = GetAvailableBufSize();
-    }
-    return (availSize >= size);
+    ring_.resize(RoundUpPowerOfTwo(capacity));
+    mask_ = ring_.size() - 1;
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+bool CircleStreamBuffer::CheckWrite(size_t size) const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return CircleStreamBufferCheckWrite(circleBufferPtr_.get(), size);
+#else
+    return (size <= ring_.size() - UnreadSize());
 #endif // OHOS_BUILD_ENABLE_RUST
 }
 
 bool CircleStreamBuffer::Write(const char *buf, size_t size)
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
-    return CircleStreamBufferWrite(streamBufferPtr_.get(), buf, size);
+    return CircleStreamBufferWrite(circleBufferPtr_.get(), buf, size);
 #else
+    CHKPF(buf);
     if (!CheckWrite(size)) {
-        SEN_HILOGE("Buffer is overflow, availableSize:%{public}zu, size:%{public}zu,"
-                   "unreadSize:%{public}zu, rPos:%{public}zu, wPos:%{public}zu",
-                   GetAvailableBufSize(), size, UnreadSize(), rPos_, wPos_);
+        SEN_HILOGE("Buffer is overflow, capacity:%{public}zu, size:%{public}zu, unreadSize:%{public}zu",
+            ring_.size(), size, UnreadSize());
+        return false;
+    }
+    size_t pos = wPos_ & mask_;
+    size_t first = std::min(size, ring_.size() - pos);
+    if (memcpy_s(&ring_[pos], ring_.size() - pos, buf, first) != EOK) {
+        SEN_HILOGE("Failed to call memcpy_s");
         return false;
     }
-    return StreamBuffer::Write(buf, size);
+    if ((size > first) && (memcpy_s(&ring_[0], ring_.size(), buf + first, size - first) != EOK)) {
+        SEN_HILOGE("Failed to call memcpy_s");
+        return false;
+    }
+    wPos_ += size;
+    return true;
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+bool CircleStreamBuffer::Peek(size_t offset, char *buf, size_t size) const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return CircleStreamBufferPeek(circleBufferPtr_.get(), offset, buf, size);
+#else
+    CHKPF(buf);
+    if ((offset > UnreadSize()) || (size > UnreadSize() - offset)) {
+        SEN_HILOGE("Memory out of bounds on peek, offset:%{public}zu, size:%{public}zu", offset, size);
+        return false;
+    }
+    size_t pos = (rPos_ + offset) & mask_;
+    size_t first = std::min(size, ring_.size() - pos);
+    if ((first > 0) && (memcpy_s(buf, size, &ring_[pos], first) != EOK)) {
+        SEN_HILOGE("Failed to call memcpy_s");
+        return false;
+    }
+    if ((size > first) && (memcpy_s(buf + first, size - first, &ring_[0], size - first) != EOK)) {
+        SEN_HILOGE("Failed to call memcpy_s");
+        return false;
+    }
+    return true;
 #endif // OHOS_BUILD_ENABLE_RUST
 }
 
-void CircleStreamBuffer::CopyDataToBegin()
+bool CircleStreamBuffer::SeekReadPos(size_t n)
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
-    CircleStreamBufferCopyDataToBegin(streamBufferPtr_.get());
+    return CircleStreamBufferSeekReadPos(circleBufferPtr_.get(), n);
 #else
-    size_t unreadSize = UnreadSize();
-    if (unreadSize > 0 && rPos_ > 0) {
-        size_t pos = 0;
-        for (size_t i = rPos_; i <= wPos_;) {
-            szBuff_[pos++] = szBuff_[i++];
-        }
+    if (n > UnreadSize()) {
+        SEN_HILOGE("The position in the calculation is not as expected, n:%{public}zu, unreadSize:%{public}zu",
+            n, UnreadSize());
+        return false;
     }
-    SEN_HILOGD("UnreadSize:%{public}zu, rPos:%{public}zu, wPos:%{public}zu", unreadSize, rPos_, wPos_);
+    rPos_ += n;
+    return true;
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+void CircleStreamBuffer::Reset()
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    CircleStreamBufferReset(circleBufferPtr_.get());
+#else
     rPos_ = 0;
-    wPos_ = unreadSize;
+    wPos_ = 0;
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+bool CircleStreamBuffer::IsEmpty() const
+{
+    return (UnreadSize() == 0);
+}
+
+size_t CircleStreamBuffer::UnreadSize() const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return CircleStreamBufferUnreadSize(circleBufferPtr_.get());
+#else
+    return wPos_ - rPos_;
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+size_t CircleStreamBuffer::ContiguousReadSize() const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return CircleStreamBufferContiguousReadSize(circleBufferPtr_.get());
+#else
+    return std::min(UnreadSize(), ring_.size() - (rPos_ & mask_));
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+size_t CircleStreamBuffer::Capacity() const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return CircleStreamBufferCapacity(circleBufferPtr_.get());
+#else
+    return ring_.size();
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+const char *CircleStreamBuffer::ReadBuf() const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return CircleStreamBufferReadBuf(circleBufferPtr_.get());
+#else
+    return &ring_[rPos_ & mask_];
 #endif // OHOS_BUILD_ENABLE_RUST
 }
 } // namespace Sensors
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -25,6 +25,12 @@ NetPacket::NetPacket(const NetPacket &pkt) : NetPacket(pkt.GetMsgId())
     Clone(pkt);
 }
 
+void NetPacket::Reset(MessageId msgId)
+{
+    StreamBuffer::Reset();
+    msgId_ = msgId;
+}
+
 void NetPacket::MakeData(StreamBuffer &buf) const
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
@@ -48,6 +54,25 @@ void NetPacket::MakeData(StreamBuffer &buf) const
 #endif // OHOS_BUILD_ENABLE_RUST
 }
 
+PackHead NetPacket::MakeHead() const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    PACKHEAD head = {msgId_, static_cast<size_t>(StreamBufferGetWpos(streamBufferPtr_.get()))};
+#else
+    PACKHEAD head = {msgId_, wPos_};
+#endif // OHOS_BUILD_ENABLE_RUST
+    return head;
+}
+
+const char *NetPacket::GetPayload() const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return StreamBufferGetSzBuff(streamBufferPtr_.get());
+#else
+    return &szBuff_[0];
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
 size_t NetPacket::GetSize() const
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
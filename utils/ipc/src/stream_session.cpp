@@ -32,86 +32,178 @@ StreamSession::StreamSession(const std::string &programName, const int32_t fd, c
     StreamSessionSetFd(streamSessionPtr_.get(), fd);
     StreamSessionSetUid(streamSessionPtr_.get(), uid);
     StreamSessionSetPid(streamSessionPtr_.get(), pid);
-    UpdateDescript();
 }
 #else
 ,
       fd_(fd),
       uid_(uid),
       pid_(pid)
-{
-    UpdateDescript();
-}
+{}
 #endif // OHOS_BUILD_ENABLE_RUST
 
 
 bool StreamSession::SendMsg(const char *buf, size_t size) const
 {
-#ifdef OHOS_BUILD_ENABLE_RUST
-    return StreamSessionSendMsg(streamSessionPtr_.get(), buf, size);
-#else
     CHKPF(buf);
+    struct iovec iov = { const_cast<char *>(buf), size };
+    return SendIov(&iov, 1);
+}
+
+bool StreamSession::SendIov(const struct iovec *iov, size_t iovCount) const
+{
+    CHKPF(iov);
+    size_t size = 0;
+    for (size_t i = 0; i < iovCount; ++i) {
+        size += iov[i].iov_len;
+    }
     if ((size == 0) || (size > MAX_PACKET_BUF_SIZE)) {
         SEN_HILOGE("buf size:%{public}zu", size);
         return false;
     }
+    std::lock_guard<std::mutex> outputLock(outputMutex_);
+    if (!FlushOutputLocked()) {
+        return false;
+    }
+    if (!outputBuf_.empty()) {
+        return QueueOutput(iov, iovCount, 0);
+    }
+    ssize_t count = TrySendIov(iov, iovCount);
+    if (count < 0) {
+        return false;
+    }
+    if (static_cast<size_t>(count) == size) {
+        return true;
+    }
+    if (!QueueOutput(iov, iovCount, static_cast<size_t>(count))) {
+        return false;
+    }
+    if (writableNotifier_ != nullptr) {
+        writableNotifier_(GetFd(), true);
+    }
+    return true;
+}
+
+ssize_t StreamSession::TrySendIov(const struct iovec *iov, size_t iovCount) const
+{
+#ifdef OHOS_BUILD_ENABLE_RUST
+    return StreamSessionTrySendIov(streamSessionPtr_.get(), iov, iovCount);
+#else
     if (fd_ < 0) {
         SEN_HILOGE("The fd_ is less than 0");
+        return -1;
+    }
+    struct msghdr msg = {};
+    msg.msg_iov = const_cast<struct iovec *>(iov);
+    msg.msg_iovlen = iovCount;
+    ssize_t count = sendmsg(fd_, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (count >= 0) {
+        return count;
+    }
+    if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
+        SEN_HILOGD("Socket is full, errno:%{public}d", errno);
+        return 0;
+    }
+    SEN_HILOGE("Send return failed, error:%{public}d, fd:%{public}d", errno, fd_);
+    return -1;
+#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+bool StreamSession::QueueOutput(const struct iovec *iov, size_t iovCount, size_t skip) const
+{
+    size_t size = 0;
+    for (size_t i = 0; i < iovCount; ++i) {
+        size += iov[i].iov_len;
+    }
+    // A packet that is partially on the wire has to be completed, otherwise the stream loses its framing
+    if ((skip == 0) && (outputBuf_.size() + size > MAX_SESSION_OUTPUT_SIZE)) {
+        SEN_HILOGE("Output queue is full, drop packet, queued:%{public}zu, size:%{public}zu",
+            outputBuf_.size(), size);
         return false;
     }
-    size_t idx = 0;
-    size_t retryCount = 0;
-    size_t remSize = size;
-    while (remSize > 0 && retryCount < SEND_RETRY_LIMIT) {
-        ++retryCount;
-        auto count = send(fd_, &buf[idx], remSize, MSG_DONTWAIT | MSG_NOSIGNAL);
+    for (size_t i = 0; i < iovCount; ++i) {
+        if (skip >= iov[i].iov_len) {
+            skip -= iov[i].iov_len;
+            continue;
+        }
+        const char *base = static_cast<const char *>(iov[i].iov_base);
+        outputBuf_.insert(outputBuf_.end(), base + skip, base + iov[i].iov_len);
+        skip = 0;
+    }
+    return true;
+}
+
+bool StreamSession::FlushOutputLocked() const
+{
+    while (!outputBuf_.empty()) {
+        struct iovec iov = { outputBuf_.data(), outputBuf_.size() };
+        ssize_t count = TrySendIov(&iov, 1);
         if (count < 0) {
-            if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
-#ifdef OHOS_BUILD_ENABLE_RUST
-                sleep(Duration::from_micros(SEND_RETRY_SLEEP_TIME));
-#else
-                usleep(SEND_RETRY_SLEEP_TIME);
-#endif
-                SEN_HILOGW("Continue for errno EAGAIN|EINTR|EWOULDBLOCK, errno:%{public}d", errno);
-                continue;
-            }
-            SEN_HILOGE("Send return failed, error:%{public}d, fd:%{public}d", errno, fd_);
+            outputBuf_.clear();
             return false;
         }
-        idx += static_cast<size_t>(count);
-        remSize -= static_cast<size_t>(count);
-        if (remSize > 0) {
-#ifdef OHOS_BUILD_ENABLE_RUST
-            sleep(Duration::from_micros(SEND_RETRY_SLEEP_TIME));
-#else
-            usleep(SEND_RETRY_SLEEP_TIME);
-#endif
+        if (count == 0) {
+            break;
         }
-    }
-    if (retryCount >= SEND_RETRY_LIMIT || remSize != 0) {
-        SEN_HILOGE("Send too many times:%{public}zu/%{public}zu, size:%{public}zu/%{public}zu, fd:%{public}d",
-            retryCount, SEND_RETRY_LIMIT, idx, size, fd_);
-        return false;
+        outputBuf_.erase(outputBuf_.begin(), outputBuf_.begin() + count);
     }
     return true;
-#endif // OHOS_BUILD_ENABLE_RUST
+}
+
+void StreamSession::FlushOutput()
+{
+    std::lock_guard<std::mutex> outputLock(outputMutex_);
+    FlushOutputLocked();
+    if (outputBuf_.empty() && (writableNotifier_ != nullptr)) {
+        writableNotifier_(GetFd(), false);
+    }
+}
+
+void StreamSession::ClearOutput()
+{
+    std::lock_guard<std::mutex> outputLock(outputMutex_);
+    outputBuf_.clear();
+    outputBuf_.shrink_to_fit();
+}
+
+size_t StreamSession::GetOutputSize() const
+{
+    std::lock_guard<std::mutex> outputLock(outputMutex_);
+    return outputBuf_.size();
+}
+
+size_t StreamSession::GetMemorySize() const
+{
+    size_t size = sizeof(StreamSession) + programName_.capacity();
+    {
+        std::lock_guard<std::mutex> outputLock(outputMutex_);
+        size += outputBuf_.capacity();
+    }
+    std::lock_guard<std::mutex> eventsLock(eventsMutex_);
+    for (const auto &item : events_) {
+        size += sizeof(item) + item.second.capacity() * sizeof(EventTime);
+    }
+    return size;
+}
+
+void StreamSession::SetWritableNotifier(WritableNotifier notifier)
+{
+    std::lock_guard<std::mutex> outputLock(outputMutex_);
+    writableNotifier_ = notifier;
 }
 
 void StreamSession::Close()
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
     StreamSessionClose(streamSessionPtr_.get());
-    UpdateDescript();
 #else
     if (fd_ >= 0) {
         close(fd_);
         fd_ = -1;
-        UpdateDescript();
     }
 #endif // OHOS_BUILD_ENABLE_RUST
 }
 
-void StreamSession::UpdateDescript()
+std::string StreamSession::GetDescript() const
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
     std::ostringstream oss;
@@ -123,7 +215,7 @@ void StreamSession::UpdateDescript()
         << ", pid = " << StreamSessionGetPid(streamSessionPtr_.get())
         << ", tokenType = " << StreamSessionGetTokenType(streamSessionPtr_.get())
         << std::endl;
-    descript_ = oss.str().c_str();
+    return oss.str();
 #else
     std::ostringstream oss;
     oss << "fd = " << fd_
@@ -133,7 +225,7 @@ void StreamSession::UpdateDescript()
         << ", pid = " << pid_
         << ", tokenType = " << tokenType_
         << std::endl;
-    descript_ = oss.str().c_str();
+    return oss.str();
 #endif // OHOS_BUILD_ENABLE_RUST
 }
 
@@ -141,21 +233,18 @@ bool StreamSession::SendMsg(const NetPacket &pkt) const
 {
 #ifdef OHOS_BUILD_ENABLE_RUST
     if (StreamBufferChkRWError(pkt.streamBufferPtr_.get())) {
-        SEN_HILOGE("Read and write status is error");
-        return false;
-    }
-    StreamBuffer buf;
-    pkt.MakeData(buf);
-    return SendMsg(StreamBufferData(buf.streamBufferPtr_.get()), StreamBufferSize(buf.streamBufferPtr_.get()));
 #else
     if (pkt.ChkRWError()) {
+#endif // OHOS_BUILD_ENABLE_RUST
         SEN_HILOGE("Read and write status failed");
         return false;
     }
-    StreamBuffer buf;
-    pkt.MakeData(buf);
-    return SendMsg(buf.Data(), buf.Size());
-#endif // OHOS_BUILD_ENABLE_RUST
+    PackHead head = pkt.MakeHead();
+    struct iovec iov[] = {
+        { &head, sizeof(head) },
+        { const_cast<char *>(pkt.GetPayload()), head.size },
+    };
+    return SendIov(iov, (head.size > 0) ? 2 : 1);
 }
 
 int32_t StreamSession::GetUid() const
@@ -190,11 +279,6 @@ int32_t StreamSession::GetFd() const
 #endif // OHOS_BUILD_ENABLE_RUST
 }
 
-const std::string &StreamSession::GetDescript() const
-{
-    return descript_;
-}
-
 const std::string StreamSession::GetProgramName() const
 {
     return programName_;
@@ -37,30 +37,40 @@ StreamSocket::~StreamSocket()
 void StreamSocket::OnReadPackets(CircleStreamBuffer &circBuf, StreamSocket::PacketCallBackFun callbackFun)
 {
     constexpr size_t headSize = sizeof(PackHead);
+    char data[MAX_PACKET_BUF_SIZE] = {};
+    NetPacket pkt(MessageId::INVALID);
     for (size_t i = 0; i < ONCE_PROCESS_NETPACKET_LIMIT; ++i) {
         const size_t unreadSize = circBuf.UnreadSize();
         if (unreadSize < headSize) {
             break;
         }
-        size_t dataSize = unreadSize - headSize;
-        char *buf = const_cast<char *>(circBuf.ReadBuf());
-        CHKPB(buf);
-        PackHead *head = reinterpret_cast<PackHead *>(buf);
-        CHKPB(head);
-        if (head->size < 0 || head->size > MAX_PACKET_BUF_SIZE) {
+        PackHead head;
+        if (!circBuf.Peek(0, reinterpret_cast<char *>(&head), headSize)) {
+            break;
+        }
+        if (head.size > MAX_PACKET_BUF_SIZE) {
             SEN_HILOGE("Packet header parsing error, and this error cannot be recovered. The buffer will be reset"
-                " head->size:%{public}zu, unreadSize:%{public}zu", head->size, unreadSize);
+                " head.size:%{public}zu, unreadSize:%{public}zu", head.size, unreadSize);
             circBuf.Reset();
             break;
         }
-        if (head->size > dataSize) {
+        if (head.size > unreadSize - headSize) {
             break;
         }
-        NetPacket pkt(head->idMsg);
-        if ((head->size > 0) && (!pkt.Write(&buf[headSize], head->size))) {
-            SEN_HILOGW("Error writing data in the NetPacket. It will be retried next time. messageid:%{public}d,"
-                "size:%{public}zu", head->idMsg, head->size);
-            break;
+        pkt.Reset(head.idMsg);
+        if (head.size > 0) {
+            const char *payload = circBuf.ReadBuf() + headSize;
+            if (circBuf.ContiguousReadSize() < headSize + head.size) {
+                if (!circBuf.Peek(headSize, data, head.size)) {
+                    break;
+                }
+                payload = data;
+            }
+            if (!pkt.Write(payload, head.size)) {
+                SEN_HILOGW("Error writing data in the NetPacket. It will be retried next time. messageid:%{public}d,"
+                    "size:%{public}zu", head.idMsg, head.size);
+                break;
+            }
         }
         if (!circBuf.SeekReadPos(pkt.GetPacketLength())) {
             SEN_HILOGW("Set read position error, and this error cannot be recovered, and the buffer will be reset"